@@ -1052,6 +1052,60 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo asyncRenderPassReplay = {
+        "asyncRenderPassReplay",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo copyOcclusionQueryResultsToBuffer = {
+        "copyOcclusionQueryResultsToBuffer",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo asyncQueueSubmit = {
+        "asyncQueueSubmit",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo budgetAwareAllocation = {
+        "budgetAwareAllocation",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo mergeRenderPassesAcrossFramebuffers = {
+        "mergeRenderPassesAcrossFramebuffers",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo clearScissoredAttachmentsWithLoadOp = {
+        "clearScissoredAttachmentsWithLoadOp",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo useTimelineSemaphoreForSubmissions = {
+        "useTimelineSemaphoreForSubmissions",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo deferSubmissionOnShareGroupContextSwitch = {
+        "deferSubmissionOnShareGroupContextSwitch",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo speculativeReadbackForDeviceLocalBuffers = {
+        "speculativeReadbackForDeviceLocalBuffers",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo useResetCommandBufferBitForSecondaryPools = {
         "useResetCommandBufferBitForSecondaryPools",
         FeatureCategory::VulkanWorkarounds,
@@ -1118,6 +1172,18 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsPushDescriptor = {
+        "supportsPushDescriptor",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo pushTextureDescriptors = {
+        "pushTextureDescriptors",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo allowHostImageCopyDespiteNonIdenticalLayout = {
         "allowHostImageCopyDespiteNonIdenticalLayout",
         FeatureCategory::VulkanFeatures,
@@ -183,6 +183,18 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo offloadGlCallsToWorkerThread = {
+        "offloadGlCallsToWorkerThread",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo swapBuffersWithoutGlobalLock = {
+        "swapBuffersWithoutGlobalLock",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
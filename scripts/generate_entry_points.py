@@ -32,6 +32,79 @@ NO_EVENT_MARKER_EXCEPTIONS_LIST = sorted([
     "glInsertEventMarkerEXT",
 ])
 
+# Entry points whose calls may be handed to the context's offload thread when the
+# offloadGlCallsToWorkerThread frontend feature is enabled.  These are the calls commonly made per
+# draw.  Calls that change the state the application thread uses to decide what to offload (see
+# Context::offloadCall) are not listed, or are limited by OFFLOADED_GL_COMMAND_CONDITIONS.  Pointer
+# parameters the call reads are copied before the entry point returns; they map to (count
+# parameter, components per count).
+OFFLOADED_GL_COMMANDS = {
+    "glActiveTexture": {},
+    "glBindBuffer": {},
+    "glBindFramebuffer": {},
+    "glBindTexture": {},
+    "glBlendColor": {},
+    "glBlendEquation": {},
+    "glBlendEquationSeparate": {},
+    "glBlendFunc": {},
+    "glBlendFuncSeparate": {},
+    "glClear": {},
+    "glClearColor": {},
+    "glClearDepthf": {},
+    "glClearStencil": {},
+    "glColorMask": {},
+    "glCullFace": {},
+    "glDepthFunc": {},
+    "glDepthMask": {},
+    "glDisable": {},
+    "glDrawArrays": {},
+    "glDrawArraysInstanced": {},
+    "glDrawElements": {},
+    "glDrawElementsInstanced": {},
+    "glEnable": {},
+    "glFrontFace": {},
+    "glPolygonOffset": {},
+    "glScissor": {},
+    "glStencilFunc": {},
+    "glStencilMask": {},
+    "glStencilOp": {},
+    "glUniform1f": {},
+    "glUniform1fv": {
+        "value": ("count", 1)
+    },
+    "glUniform1i": {},
+    "glUniform1iv": {
+        "value": ("count", 1)
+    },
+    "glUniform2f": {},
+    "glUniform2fv": {
+        "value": ("count", 2)
+    },
+    "glUniform3f": {},
+    "glUniform3fv": {
+        "value": ("count", 3)
+    },
+    "glUniform4f": {},
+    "glUniform4fv": {
+        "value": ("count", 4)
+    },
+    "glUniformMatrix3fv": {
+        "value": ("count", 9)
+    },
+    "glUniformMatrix4fv": {
+        "value": ("count", 16)
+    },
+    "glUseProgram": {},
+    "glViewport": {},
+}
+
+# Conditions on the parameters of OFFLOADED_GL_COMMANDS for the call to be offloaded.
+OFFLOADED_GL_COMMAND_CONDITIONS = {
+    "glBindBuffer": "target != GL_ELEMENT_ARRAY_BUFFER",
+    "glDisable": "cap != GL_DEBUG_OUTPUT",
+    "glEnable": "cap != GL_DEBUG_OUTPUT",
+}
+
 ALIASING_EXCEPTIONS = [
     # glRenderbufferStorageMultisampleEXT aliases
     # glRenderbufferStorageMultisample on desktop GL, and is marked as such in
@@ -298,7 +371,7 @@ TEMPLATE_GLES_ENTRY_POINT_NO_RETURN = """\
 void GL_APIENTRY GL_{name}({params})
 {{
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = {context_getter};
+    Context *context = {context_getter};{offload_call}
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
     if ({valid_context_check})
@@ -323,7 +396,7 @@ TEMPLATE_GLES_CONTEXT_PRIVATE_ENTRY_POINT_NO_RETURN = """\
 void GL_APIENTRY GL_{name}({params})
 {{
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = {context_getter};
+    Context *context = {context_getter};{offload_call}
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
     if ({valid_context_check})
@@ -1278,6 +1351,14 @@ LIBCL_SOURCE_INCLUDES = """\
 #include "libANGLE/capture/capture_cl_autogen.h"
 """
 
+TEMPLATE_OFFLOAD_CALL = """
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, {entry_point_name}, {condition}, GL_{name}{comma_if_needed}{offload_params}))
+    {{
+        return;
+    }}
+"""
+
 TEMPLATE_EVENT_COMMENT = """\
     // Don't run the EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
@@ -1648,6 +1729,13 @@ def is_egl_sync_entry_point(cmd_name):
     return False
 
 
+# egl entry points that may swap the surface current to the calling thread without the global lock
+def is_egl_swap_buffers_entry_point(cmd_name):
+    return cmd_name in [
+        "eglSwapBuffers", "eglSwapBuffersWithDamageKHR", "eglPrepareSwapBuffersANGLE"
+    ]
+
+
 # egl entry points whose code path writes to resources that can be accessed
 # by both EGL Sync APIs and EGL Non-Sync APIs
 def is_egl_entry_point_accessing_both_sync_and_non_sync_API_resources(cmd_name):
@@ -1913,6 +2001,9 @@ def get_context_getter_function(cmd_name):
     if is_context_lost_acceptable_cmd(cmd_name):
         return "GetGlobalContext()"
 
+    if cmd_name in OFFLOADED_GL_COMMANDS:
+        return "GetValidGlobalContextForOffload()"
+
     return "GetValidGlobalContext()"
 
 
@@ -2100,6 +2191,8 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, cmd_packe
             get_context_lock(api, cmd_name),
         "implicit_pls_disable":
             get_implicit_pls_disable(cmd_name),
+        "offload_call":
+            get_offload_call(cmd_name, entry_point_name, params),
         "preamble":
             get_preamble(api, cmd_name, params),
         "epilog":
@@ -3296,6 +3389,8 @@ def get_egl_lock(cmd_name):
         return "ANGLE_SCOPED_GLOBAL_EGL_SYNC_LOCK();"
     if is_egl_entry_point_accessing_both_sync_and_non_sync_API_resources(cmd_name):
         return "ANGLE_SCOPED_GLOBAL_EGL_AND_EGL_SYNC_LOCK();"
+    if is_egl_swap_buffers_entry_point(cmd_name):
+        return "ANGLE_SCOPED_SWAP_BUFFERS_LOCK(thread, dpy, surface);"
     else:
         return "ANGLE_SCOPED_GLOBAL_LOCK();"
 
@@ -3328,6 +3423,30 @@ def get_prepare_swap_buffers_call(api, cmd_name, params):
     return prepareCall
 
 
+def get_offload_call(cmd_name, entry_point_name, params):
+    if cmd_name not in OFFLOADED_GL_COMMANDS:
+        return ""
+
+    copied_params = OFFLOADED_GL_COMMANDS[cmd_name]
+    offload_params = []
+    for param in params:
+        name = just_the_name(param)
+        if name in copied_params:
+            count, components = copied_params[name]
+            element_type = just_the_type(param).replace("const", "").replace("*", "").strip()
+            offload_params.append("OffloadedArray<%s>(%s, %s, %d)" %
+                                  (element_type, name, count, components))
+        else:
+            offload_params.append(name)
+
+    return TEMPLATE_OFFLOAD_CALL.format(
+        entry_point_name=entry_point_name,
+        condition=OFFLOADED_GL_COMMAND_CONDITIONS.get(cmd_name, "true"),
+        name=strip_api_prefix(cmd_name),
+        comma_if_needed=", " if offload_params else "",
+        offload_params=", ".join(offload_params))
+
+
 def get_implicit_pls_disable(cmd_name):
     if not is_implicit_pls_disable_command(cmd_name):
         return ""
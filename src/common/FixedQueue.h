@@ -59,6 +59,11 @@ class FixedQueue final : angle::NonCopyable
     reference back();
     const_reference back() const;
 
+    // The element |index| places after the front.  Like front(), this can be used concurrently with
+    // push() for any index less than a previously read size().
+    reference operator[](size_type index);
+    const_reference operator[](size_type index) const;
+
     void pop();
     void clear();
 
@@ -180,6 +185,21 @@ ANGLE_INLINE typename FixedQueue<T>::const_reference FixedQueue<T>::back() const
     return mData[(mEndIndex + (mMaxSize - 1)) % mMaxSize];
 }
 
+template <class T>
+ANGLE_INLINE typename FixedQueue<T>::reference FixedQueue<T>::operator[](size_type index)
+{
+    ASSERT(index < size());
+    return mData[(mFrontIndex + index) % mMaxSize];
+}
+
+template <class T>
+ANGLE_INLINE typename FixedQueue<T>::const_reference FixedQueue<T>::operator[](
+    size_type index) const
+{
+    ASSERT(index < size());
+    return mData[(mFrontIndex + index) % mMaxSize];
+}
+
 template <class T>
 void FixedQueue<T>::pop()
 {
@@ -121,6 +121,27 @@ TEST(FixedQueue, WrapAround)
     }
 }
 
+// Test indexing from the front, including across the wrap around.
+TEST(FixedQueue, Index)
+{
+    FixedQueue<int> q(5);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        q.push(i);
+    }
+    q.pop();
+    q.pop();
+    q.push(5);
+
+    ASSERT_EQ(4u, q.size());
+    for (size_t i = 0; i < q.size(); ++i)
+    {
+        EXPECT_EQ(static_cast<int>(i) + 2, q[i]);
+    }
+    EXPECT_EQ(q.back(), q[q.size() - 1]);
+}
+
 // Test concurrent push and pop behavior.
 TEST(FixedQueue, ConcurrentPushPop)
 {
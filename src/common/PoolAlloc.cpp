@@ -9,6 +9,7 @@
 
 #include "common/PoolAlloc.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -167,6 +168,8 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mInUseList(nullptr),
       mNumCalls(0),
       mTotalBytes(0),
+      mInUseBytes(0),
+      mPeakInUseBytes(0),
 #endif
       mLocked(false)
 {
@@ -310,6 +313,8 @@ void PoolAllocator::pop(ReleaseStrategy releaseStrategy)
         // invoke destructor to free allocation list
         mInUseList->~PageHeader();
 
+        onPagesReleased(pageCount);
+
         if (pageCount > 1 || releaseStrategy == ReleaseStrategy::All)
         {
             delete[] reinterpret_cast<char *>(mInUseList);
@@ -399,8 +404,10 @@ void *PoolAllocator::allocate(size_t numBytes)
         }
 
         // Use placement-new to initialize header
-        new (memory) PageHeader(mInUseList, (numBytesToAlloc + mPageSize - 1) / mPageSize);
+        const size_t pageCount = (numBytesToAlloc + mPageSize - 1) / mPageSize;
+        new (memory) PageHeader(mInUseList, pageCount);
         mInUseList = memory;
+        onPagesAcquired(pageCount);
 
         // Make next allocation come from a new page
         mCurrentPageOffset = mPageSize;
@@ -448,6 +455,7 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     // Use placement-new to initialize header
     new (memory) PageHeader(mInUseList, 1);
     mInUseList = memory;
+    onPagesAcquired(1);
 
     // Leave room for the page header.
     mCurrentPageOffset      = mPageHeaderSkip;
@@ -472,7 +480,44 @@ void *PoolAllocator::initializeAllocation(uint8_t *memory, size_t numBytes)
 
     return Allocation::GetDataPointer(memory, mAlignment);
 }
+
+void PoolAllocator::onPagesAcquired(size_t pageCount)
+{
+    mInUseBytes += pageCount * mPageSize;
+    mPeakInUseBytes = std::max(mPeakInUseBytes, mInUseBytes);
+}
+
+void PoolAllocator::onPagesReleased(size_t pageCount)
+{
+    ASSERT(mInUseBytes >= pageCount * mPageSize);
+    mInUseBytes -= pageCount * mPageSize;
+}
+#endif
+
+size_t PoolAllocator::getInUseBytes() const
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    return mInUseBytes;
+#else
+    return 0;
+#endif
+}
+
+size_t PoolAllocator::getPeakInUseBytes() const
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    return mPeakInUseBytes;
+#else
+    return 0;
+#endif
+}
+
+void PoolAllocator::resetPeakInUseBytes()
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    mPeakInUseBytes = mInUseBytes;
 #endif
+}
 
 void PoolAllocator::lock()
 {
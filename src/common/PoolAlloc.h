@@ -138,6 +138,15 @@ class PoolAllocator : angle::NonCopyable
     void lock();
     void unlock();
 
+    //
+    // Statistics on the memory obtained from the OS.  The peak is the high-water mark of bytes held
+    // by in-use pages since construction or the last call to resetPeakInUseBytes().  Always zero
+    // when ANGLE_DISABLE_POOL_ALLOC is defined.
+    //
+    size_t getInUseBytes() const;
+    size_t getPeakInUseBytes() const;
+    void resetPeakInUseBytes();
+
   private:
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
@@ -153,6 +162,9 @@ class PoolAllocator : angle::NonCopyable
     uint8_t *allocateNewPage(size_t numBytes);
     // Track allocations if and only if we're using guard blocks
     void *initializeAllocation(uint8_t *memory, size_t numBytes);
+    // Account for pages entering or leaving the in-use list.
+    void onPagesAcquired(size_t pageCount);
+    void onPagesReleased(size_t pageCount);
 
     // Granularity of allocation from the OS
     size_t mPageSize;
@@ -175,6 +187,10 @@ class PoolAllocator : angle::NonCopyable
     int mNumCalls;       // just an interesting statistic
     size_t mTotalBytes;  // just an interesting statistic
 
+    // Bytes held by pages in mInUseList, and the high-water mark of that value.
+    size_t mInUseBytes;
+    size_t mPeakInUseBytes;
+
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
 #endif
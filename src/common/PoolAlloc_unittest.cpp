@@ -50,6 +50,38 @@ TEST(PoolAllocatorTest, Interface)
     poolAllocator.popAll();
 }
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+// Verify that the peak in-use statistic tracks the high-water mark across push/pop
+TEST(PoolAllocatorTest, PeakInUseBytes)
+{
+    PoolAllocator poolAllocator;
+    EXPECT_EQ(0u, poolAllocator.getInUseBytes());
+    EXPECT_EQ(0u, poolAllocator.getPeakInUseBytes());
+
+    poolAllocator.push();
+    poolAllocator.allocate(1024);
+    poolAllocator.allocate(64 * 1024);
+    const size_t peak = poolAllocator.getPeakInUseBytes();
+    EXPECT_GE(peak, 65u * 1024u);
+    EXPECT_EQ(peak, poolAllocator.getInUseBytes());
+
+    // Popping releases the pages, but the peak remains until reset.
+    poolAllocator.pop();
+    EXPECT_EQ(0u, poolAllocator.getInUseBytes());
+    EXPECT_EQ(peak, poolAllocator.getPeakInUseBytes());
+
+    poolAllocator.resetPeakInUseBytes();
+    EXPECT_EQ(0u, poolAllocator.getPeakInUseBytes());
+
+    // Reused pages from the free list count toward in-use bytes again.
+    poolAllocator.push();
+    poolAllocator.allocate(1024);
+    EXPECT_GT(poolAllocator.getInUseBytes(), 0u);
+    EXPECT_EQ(poolAllocator.getInUseBytes(), poolAllocator.getPeakInUseBytes());
+    poolAllocator.popAll();
+}
+#endif
+
 #if !defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
 // Verify allocations are correctly aligned for different alignments
 class PoolAllocatorAlignmentTest : public testing::TestWithParam<int>
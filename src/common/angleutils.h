@@ -101,8 +101,11 @@ struct PerfMonitorTriplet
     FN(vkQueueSubmitCallsPerFrame)                 \
     FN(commandQueueWaitSemaphoresTotal)            \
     FN(renderPasses)                               \
+    FN(renderPassesMergedAcrossFramebuffers)       \
     FN(writeDescriptorSets)                        \
     FN(flushedOutsideRenderPassCommandBuffers)     \
+    FN(pipelineBarriersRequested)                  \
+    FN(pipelineBarriersIssued)                     \
     FN(swapchainCreate)                            \
     FN(swapchainResolveInSubpass)                  \
     FN(swapchainResolveOutsideSubpass)             \
@@ -185,6 +185,15 @@
 #    define ANGLE_WITH_SANITIZER 1
 #endif  // defined(ANGLE_WITH_ASAN) || defined(ANGLE_WITH_TSAN) || defined(ANGLE_WITH_UBSAN)
 
+// Annotation for the thread_local variables read by every entry point (the current thread and
+// the current valid context).  constinit lets other translation units access them without calling
+// the thread_local wrapper function.
+#if defined(__cpp_constinit)
+#    define ANGLE_TLS_CONSTINIT constinit
+#else
+#    define ANGLE_TLS_CONSTINIT
+#endif
+
 #include <stdint.h>
 #if INTPTR_MAX == INT64_MAX
 #    define ANGLE_IS_64_BIT_CPU 1
@@ -14,6 +14,7 @@
 #include "common/CompiledShaderState.h"
 #include "common/PackedEnums.h"
 #include "common/angle_version_info.h"
+#include "common/system_utils.h"
 
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/CollectVariables.h"
@@ -625,8 +626,12 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     ASSERT(mSymbolTable.atGlobalLevel());
 
     // Parse shader.
-    if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                       &parseContext) != 0)
+    double phaseStartTime = angle::GetCurrentSystemTime();
+    const int parseResult =
+        PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
+                       &parseContext);
+    mCompileStatistics.parseTimeSeconds = angle::GetCurrentSystemTime() - phaseStartTime;
+    if (parseResult != 0)
     {
         return nullptr;
     }
@@ -644,7 +649,11 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     }
 
     TIntermBlock *root = parseContext.getTreeRoot();
-    if (!checkAndSimplifyAST(root, parseContext, compileOptions))
+
+    phaseStartTime      = angle::GetCurrentSystemTime();
+    const bool astValid = checkAndSimplifyAST(root, parseContext, compileOptions);
+    mCompileStatistics.astPassesTimeSeconds = angle::GetCurrentSystemTime() - phaseStartTime;
+    if (!astValid)
     {
         return nullptr;
     }
@@ -1506,6 +1515,7 @@ bool TCompiler::compile(const char *const shaderStrings[],
     }
 
     TScopedPoolAllocator scopedAlloc(&allocator);
+    allocator.resetPeakInUseBytes();
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
     if (root)
@@ -1518,11 +1528,16 @@ bool TCompiler::compile(const char *const shaderStrings[],
         if (compileOptions.objectCode)
         {
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
-            if (!translate(root, compileOptions, &perfDiagnostics))
+            const double codeGenStartTime = angle::GetCurrentSystemTime();
+            const bool translated         = translate(root, compileOptions, &perfDiagnostics);
+            mCompileStatistics.codeGenTimeSeconds =
+                angle::GetCurrentSystemTime() - codeGenStartTime;
+            if (!translated)
             {
                 return false;
             }
         }
+        mCompileStatistics.peakPoolBytes = allocator.getPeakInUseBytes();
 
         if (mShaderType == GL_VERTEX_SHADER)
         {
@@ -1748,6 +1763,8 @@ void TCompiler::clearResults()
 
     mNumViews = -1;
 
+    mCompileStatistics = {};
+
     mClipDistanceSize = 0;
     mCullDistanceSize = 0;
 
@@ -84,6 +84,17 @@ struct TFunctionMetadata
     bool used = false;
 };
 
+// Cost breakdown of the last compilation, used by the compiler perf tests.  Preprocessing is driven
+// by the lexer, so its cost is included in the parse time.
+struct TCompileStatistics
+{
+    double parseTimeSeconds     = 0;
+    double astPassesTimeSeconds = 0;
+    double codeGenTimeSeconds   = 0;
+    // High-water mark of the compiler's pool allocator during the compilation.
+    size_t peakPoolBytes = 0;
+};
+
 //
 // The base class for the machine dependent compiler to derive from
 // for managing object code from the compile.
@@ -111,6 +122,7 @@ class TCompiler : public TShHandleBase
     // Get results of the last compilation.
     int getShaderVersion() const { return mShaderVersion; }
     TInfoSink &getInfoSink() { return mInfoSink; }
+    const TCompileStatistics &getCompileStatistics() const { return mCompileStatistics; }
 
     bool specifyEarlyFragmentTests() { return mEarlyFragmentTestsSpecified = true; }
     bool isEarlyFragmentTestsSpecified() const { return mEarlyFragmentTestsSpecified; }
@@ -398,6 +410,8 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    TCompileStatistics mCompileStatistics;
 };
 
 //
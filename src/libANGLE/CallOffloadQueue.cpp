@@ -0,0 +1,147 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CallOffloadQueue.cpp: Implements the gl::CallOffloadQueue class.
+
+#include "libANGLE/CallOffloadQueue.h"
+
+#include "common/system_utils.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/ErrorStrings.h"
+
+namespace gl
+{
+namespace
+{
+// Enough for a frame's worth of draws and state updates in typical content before the application
+// thread has to wait for the offload thread.  Calls are a fixed size, so the queue takes about
+// 180KB.
+constexpr size_t kCallOffloadQueueCapacity = 1024;
+
+thread_local bool gIsCallOffloadThread = false;
+}  // anonymous namespace
+
+CallOffloadQueue::CallOffloadQueue(Context *context)
+    : mContext(context),
+      mCalls(kCallOffloadQueueCapacity),
+      mStateSnapshot{},
+      mHasStateSnapshot(false),
+      mWorkerWaiting(false),
+      mExitThread(false)
+{
+    mThread = std::thread(&CallOffloadQueue::processCalls, this);
+}
+
+CallOffloadQueue::~CallOffloadQueue()
+{
+    ASSERT(!gIsCallOffloadThread);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExitThread = true;
+    }
+    mWorkAvailableCondition.notify_one();
+    mThread.join();
+    ASSERT(mCalls.empty());
+}
+
+// static
+bool CallOffloadQueue::IsOffloadThread()
+{
+    return gIsCallOffloadThread;
+}
+
+void CallOffloadQueue::enqueue(const OffloadedCall &call)
+{
+    ASSERT(!gIsCallOffloadThread);
+    ASSERT(call.canBeOffloaded());
+
+    if (mCalls.full())
+    {
+        // The snapshot stays valid since only offloaded calls have been made since it was taken.
+        waitIdle();
+    }
+    mCalls.push(call);
+
+    // The offload thread sets mWorkerWaiting before checking the queue under mMutex, so either it
+    // sees the call that was just pushed or this thread sees it waiting and wakes it up.
+    if (mWorkerWaiting.load())
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWorkAvailableCondition.notify_one();
+    }
+}
+
+void CallOffloadQueue::finish()
+{
+    ASSERT(!gIsCallOffloadThread);
+
+    mHasStateSnapshot = false;
+    waitIdle();
+}
+
+void CallOffloadQueue::waitIdle()
+{
+    if (mCalls.empty())
+    {
+        return;
+    }
+
+    // Calls are popped only after they are executed, so an empty queue means the offload thread is
+    // idle.
+    std::unique_lock<std::mutex> lock(mMutex);
+    mIdleCondition.wait(lock, [this] { return mCalls.empty(); });
+}
+
+void CallOffloadQueue::processCalls()
+{
+    angle::SetCurrentThreadName("ANGLE-GL-Offload");
+
+    // Replayed entry points look up the context the same way they do on the application thread.
+    gIsCallOffloadThread = true;
+    SetCurrentValidContext(mContext);
+
+    while (true)
+    {
+        if (mCalls.empty())
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWorkerWaiting = true;
+            mWorkAvailableCondition.wait(lock, [this] { return !mCalls.empty() || mExitThread; });
+            mWorkerWaiting = false;
+
+            if (mCalls.empty())
+            {
+                ASSERT(mExitThread);
+                break;
+            }
+        }
+
+        const OffloadedCall &call = mCalls.front();
+
+        // If an earlier call lost the context, the remaining calls behave as if they were made on
+        // a lost context.
+        if (mContext->isContextLost())
+        {
+            mContext->getMutableErrorSetForValidation()->validationError(
+                call.getEntryPoint(), GL_CONTEXT_LOST, err::kContextLost);
+        }
+        else
+        {
+            call.replay();
+        }
+
+        mCalls.pop();
+
+        if (mCalls.empty())
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mIdleCondition.notify_all();
+        }
+    }
+
+    SetCurrentValidContext(nullptr);
+}
+}  // namespace gl
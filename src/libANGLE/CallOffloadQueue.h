@@ -0,0 +1,245 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CallOffloadQueue.h: Defines the gl::CallOffloadQueue class, a queue of GL calls that a worker
+// thread validates and executes on behalf of the thread the context is current on.
+
+#ifndef LIBANGLE_CALLOFFLOADQUEUE_H_
+#define LIBANGLE_CALLOFFLOADQUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "angle_gl.h"
+#include "common/FixedQueue.h"
+#include "common/angleutils.h"
+#include "common/entry_points_enum_autogen.h"
+
+namespace gl
+{
+class Context;
+
+// A copy of the client array an offloaded call reads, since the application may reuse the memory
+// as soon as the entry point returns.  The copy is stored inline in the call, so arrays larger than
+// kMaxElementCount are not copied, and calls with such arrays are not offloaded.  Invalid counts
+// yield an empty array; validation of the replayed call rejects them before the data is accessed.
+template <typename T>
+class OffloadedArray final
+{
+  public:
+    // Two 4x4 matrices or eight vec4s.
+    static constexpr size_t kMaxElementCount = 32;
+
+    OffloadedArray(const T *data, GLsizei count, size_t componentCount)
+        : mIsNull(data == nullptr), mFits(true)
+    {
+        if (data == nullptr || count <= 0)
+        {
+            return;
+        }
+
+        const size_t elementCount = static_cast<size_t>(count) * componentCount;
+        mFits                     = elementCount <= kMaxElementCount;
+        if (mFits)
+        {
+            memcpy(mData, data, elementCount * sizeof(T));
+        }
+    }
+
+    bool fits() const { return mFits; }
+    const T *data() const { return mIsNull ? nullptr : mData; }
+
+  private:
+    T mData[kMaxElementCount];
+    bool mIsNull;
+    bool mFits;
+};
+
+namespace priv
+{
+// Offloaded parameters are stored as given, except arrays which are replayed through a pointer to
+// their copy.
+template <typename T>
+ANGLE_INLINE bool OffloadedParamFits(const T &)
+{
+    return true;
+}
+template <typename T>
+ANGLE_INLINE bool OffloadedParamFits(const OffloadedArray<T> &param)
+{
+    return param.fits();
+}
+
+template <typename T>
+ANGLE_INLINE const T &ReplayParam(const T &param)
+{
+    return param;
+}
+template <typename T>
+ANGLE_INLINE const T *ReplayParam(const OffloadedArray<T> &param)
+{
+    return param.data();
+}
+
+template <size_t Index, typename T>
+struct OffloadedParam
+{
+    T value;
+};
+
+template <typename Indices, typename... Params>
+struct OffloadedParams;
+template <size_t... Indices, typename... Params>
+struct OffloadedParams<std::index_sequence<Indices...>, Params...>
+    : OffloadedParam<Indices, Params>...
+{};
+
+template <typename Func, typename... Params>
+struct OffloadedCallRecord
+{
+    using Indices = std::index_sequence_for<Params...>;
+
+    template <size_t... Is>
+    void replay(std::index_sequence<Is...>) const
+    {
+        func(ReplayParam(static_cast<const OffloadedParam<Is, Params> &>(params).value)...);
+    }
+
+    Func func;
+    OffloadedParams<Indices, Params...> params;
+};
+}  // namespace priv
+
+// A GL call recorded by its entry point.  The entry point and its parameters are stored inline, so
+// that recording a call does not allocate.  Replaying the call re-enters the same entry point on
+// the offload thread, which then performs both validation and execution.
+class OffloadedCall final
+{
+  public:
+    // Large enough for the parameters of every offloaded entry point, including one
+    // OffloadedArray.
+    static constexpr size_t kStorageSize = 160;
+
+    OffloadedCall() : mEntryPoint(angle::EntryPoint::Invalid), mCanBeOffloaded(false) {}
+
+    // |paramsCanBeOffloaded| lets the entry point keep some uses of the call on the application
+    // thread, such as those changing state the application thread needs to decide what to offload.
+    template <typename... FuncParams, typename... Params>
+    OffloadedCall(angle::EntryPoint entryPoint,
+                  bool paramsCanBeOffloaded,
+                  void(GL_APIENTRY *func)(FuncParams...),
+                  Params... params)
+        : mEntryPoint(entryPoint)
+    {
+        using Func   = void(GL_APIENTRY *)(FuncParams...);
+        using Record = priv::OffloadedCallRecord<Func, Params...>;
+        static_assert(sizeof(Record) <= kStorageSize, "Offloaded call parameters are too large");
+        static_assert(alignof(Record) <= alignof(std::max_align_t), "Unexpected alignment");
+        static_assert(std::is_trivially_copyable<Record>::value,
+                      "Offloaded calls are copied through the queue byte by byte");
+
+        mCanBeOffloaded = paramsCanBeOffloaded && (priv::OffloadedParamFits(params) && ...);
+        if (!mCanBeOffloaded)
+        {
+            mReplay = nullptr;
+            return;
+        }
+
+        new (mStorage) Record{func, {{params}...}};
+        mReplay = [](const void *storage) {
+            const Record *record = static_cast<const Record *>(storage);
+            record->replay(typename Record::Indices());
+        };
+    }
+
+    angle::EntryPoint getEntryPoint() const { return mEntryPoint; }
+    bool canBeOffloaded() const { return mCanBeOffloaded; }
+
+    void replay() const
+    {
+        ASSERT(mCanBeOffloaded);
+        mReplay(mStorage);
+    }
+
+  private:
+    angle::EntryPoint mEntryPoint;
+    bool mCanBeOffloaded;
+    void (*mReplay)(const void *storage);
+    alignas(std::max_align_t) uint8_t mStorage[kStorageSize];
+};
+
+// Single producer (the thread the context is current on), single consumer (the offload thread).
+// The producer must call finish() before touching any context state the consumer may be using;
+// gl::Context does so for every call that is not offloaded.
+class CallOffloadQueue final : angle::NonCopyable
+{
+  public:
+    // The context state the producer needs to decide whether a call can be offloaded.  The
+    // producer takes it while the offload thread is idle, and finish() drops it as the calls that
+    // are not offloaded may change that state.  The calls that are offloaded never do.
+    struct StateSnapshot
+    {
+        bool debugOutputEnabled;
+        bool drawsReadClientVertexData;
+        bool hasElementArrayBuffer;
+    };
+
+    CallOffloadQueue(Context *context);
+    ~CallOffloadQueue();
+
+    // Blocks while the queue is full.
+    void enqueue(const OffloadedCall &call);
+    // Returns once every enqueued call has been executed.
+    void finish();
+
+    bool empty() const { return mCalls.empty(); }
+
+    bool hasStateSnapshot() const { return mHasStateSnapshot; }
+    const StateSnapshot &getStateSnapshot() const
+    {
+        ASSERT(mHasStateSnapshot);
+        return mStateSnapshot;
+    }
+    void setStateSnapshot(const StateSnapshot &snapshot)
+    {
+        ASSERT(empty());
+        mStateSnapshot    = snapshot;
+        mHasStateSnapshot = true;
+    }
+
+    // Whether the calling thread is the offload thread of any context.
+    static bool IsOffloadThread();
+
+  private:
+    void waitIdle();
+    void processCalls();
+
+    Context *const mContext;
+    angle::FixedQueue<OffloadedCall> mCalls;
+
+    // Only accessed by the producer.
+    StateSnapshot mStateSnapshot;
+    bool mHasStateSnapshot;
+
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailableCondition;
+    std::condition_variable mIdleCondition;
+    // Set by the offload thread, with mMutex held, before it waits for work.
+    std::atomic<bool> mWorkerWaiting;
+    bool mExitThread;
+
+    std::thread mThread;
+};
+}  // namespace gl
+
+#endif  // LIBANGLE_CALLOFFLOADQUEUE_H_
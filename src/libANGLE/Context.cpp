@@ -27,6 +27,7 @@
 #include "common/utilities.h"
 #include "image_util/loadimage.h"
 #include "libANGLE/Buffer.h"
+#include "libANGLE/CallOffloadQueue.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/ErrorStrings.h"
@@ -624,7 +625,7 @@ void SetCurrentValidContextTLS(Context *context)
     gCurrentValidContext = context;
 }
 #else
-thread_local Context *gCurrentValidContext = nullptr;
+thread_local ANGLE_TLS_CONSTINIT Context *gCurrentValidContext = nullptr;
 #endif
 
 // Handle setting the current context in TLS on different platforms
@@ -922,7 +923,8 @@ egl::Error Context::onDestroy(const egl::Display *display)
     // that still have it current.
     ASSERT(mIsDestroyed == true && mRefCount == 0);
 
-    ANGLE_TRY(unMakeCurrent(display));
+    ANGLE_TRY(unMakeCurrent(display, nullptr));
+    mCallOffloadQueue.reset();
 
     // Dump frame capture if enabled.
     getShareGroup()->getFrameCaptureShared()->onDestroyContext(this);
@@ -1078,12 +1080,30 @@ egl::Error Context::makeCurrent(egl::Display *display,
         return angle::ResultToEGL(implResult);
     }
 
+    // GLES1 draws are emulated with state the frontend reads on the calling thread, so calls are
+    // only offloaded for GLES2+ contexts.  EGL calls wait for the offloaded calls when they lock
+    // the context, so offloading also needs the context mutex.
+    if (mCallOffloadQueue == nullptr && egl::kIsContextMutexEnabled &&
+        getFrontendFeatures().offloadGlCallsToWorkerThread.enabled && !isGLES1())
+    {
+        mCallOffloadQueue = std::make_unique<CallOffloadQueue>(this);
+    }
+
     return egl::NoError();
 }
 
-egl::Error Context::unMakeCurrent(const egl::Display *display)
+egl::Error Context::unMakeCurrent(const egl::Display *display, const Context *nextContext)
 {
-    ANGLE_TRY(angle::ResultToEGL(mImplementation->onUnMakeCurrent(this)));
+    finishOffloadedCalls();
+
+    if (nextContext != nullptr && nextContext->getShareGroup() == getShareGroup())
+    {
+        ANGLE_TRY(angle::ResultToEGL(mImplementation->onUnMakeCurrentForShareGroupSwitch(this)));
+    }
+    else
+    {
+        ANGLE_TRY(angle::ResultToEGL(mImplementation->onUnMakeCurrent(this)));
+    }
 
     ANGLE_TRY(unsetDefaultFramebuffer());
 
@@ -1101,6 +1121,74 @@ egl::Error Context::unMakeCurrent(const egl::Display *display)
     return egl::NoError();
 }
 
+bool Context::offloadCall(const OffloadedCall &call)
+{
+    ASSERT(mCallOffloadQueue != nullptr);
+    ASSERT(!CallOffloadQueue::IsOffloadThread());
+
+    const angle::EntryPoint entryPoint = call.getEntryPoint();
+    bool canOffload                    = call.canBeOffloaded();
+
+    if (canOffload && !mCallOffloadQueue->hasStateSnapshot())
+    {
+        // The snapshot is dropped whenever this thread waits for the offloaded calls, and no call
+        // has been offloaded since, so the offload thread is idle and the state can be read.
+        ASSERT(mCallOffloadQueue->empty());
+        const VertexArray *vertexArray = mState.getVertexArray();
+
+        CallOffloadQueue::StateSnapshot snapshot;
+        snapshot.debugOutputEnabled        = mState.getDebug().isOutputEnabled();
+        snapshot.drawsReadClientVertexData =
+            (vertexArray->getClientAttribsMask() & vertexArray->getEnabledAttributesMask()).any();
+        snapshot.hasElementArrayBuffer     = vertexArray->getElementArrayBuffer() != nullptr;
+        mCallOffloadQueue->setStateSnapshot(snapshot);
+    }
+
+    if (canOffload)
+    {
+        // Debug messages must be generated on the thread that made the call.  Client vertex and
+        // index data is read while the draw executes, so such draws are not offloaded either.
+        const CallOffloadQueue::StateSnapshot &snapshot = mCallOffloadQueue->getStateSnapshot();
+        switch (entryPoint)
+        {
+            case angle::EntryPoint::GLDrawArrays:
+            case angle::EntryPoint::GLDrawArraysInstanced:
+                canOffload = !snapshot.drawsReadClientVertexData;
+                break;
+            case angle::EntryPoint::GLDrawElements:
+            case angle::EntryPoint::GLDrawElementsInstanced:
+                canOffload = !snapshot.drawsReadClientVertexData && snapshot.hasElementArrayBuffer;
+                break;
+            default:
+                break;
+        }
+        canOffload = canOffload && !snapshot.debugOutputEnabled;
+    }
+
+    if (canOffload)
+    {
+        mCallOffloadQueue->enqueue(call);
+        return true;
+    }
+
+    mCallOffloadQueue->finish();
+    if (isContextLost())
+    {
+        mErrors.validationError(entryPoint, GL_CONTEXT_LOST, err::kContextLost);
+        SetCurrentValidContext(nullptr);
+        return true;
+    }
+    return false;
+}
+
+void Context::finishOffloadedCalls()
+{
+    if (mCallOffloadQueue != nullptr)
+    {
+        mCallOffloadQueue->finish();
+    }
+}
+
 void Context::contextLostErrorOnBlockingCall(angle::EntryPoint entryPoint) const
 {
     mErrors.validationError(entryPoint, GL_CONTEXT_LOST, err::kContextLost);
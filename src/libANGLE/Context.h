@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_CONTEXT_H_
 #define LIBANGLE_CONTEXT_H_
 
+#include <atomic>
 #include <mutex>
 #include <set>
 #include <string>
@@ -64,12 +65,14 @@ class Thread;
 namespace gl
 {
 class Buffer;
+class CallOffloadQueue;
 class Compiler;
 class FenceNV;
 class GLES1Renderer;
 class MemoryProgramCache;
 class MemoryShaderCache;
 class MemoryObject;
+class OffloadedCall;
 class PixelLocalStoragePlane;
 class Program;
 class ProgramPipeline;
@@ -540,7 +543,18 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     egl::Error makeCurrent(egl::Display *display,
                            egl::Surface *drawSurface,
                            egl::Surface *readSurface);
-    egl::Error unMakeCurrent(const egl::Display *display);
+    // |nextContext| is the context the thread makes current next, if any.
+    egl::Error unMakeCurrent(const egl::Display *display, const Context *nextContext);
+
+    // With the offloadGlCallsToWorkerThread feature, a subset of entry points hand their calls to
+    // a worker thread through offloadCall().  Every other entry point waits for the offloaded
+    // calls to finish before accessing the context.
+    bool isOffloadingCalls() const { return mCallOffloadQueue != nullptr; }
+    // Returns true if |call| was offloaded, or if it does not need to run because the context was
+    // lost by an earlier offloaded call.  Otherwise, waits for the offloaded calls to finish and
+    // returns false, and the caller executes the call itself.
+    bool offloadCall(const OffloadedCall &call);
+    void finishOffloadedCalls();
 
     // These create and destroy methods pass through to ResourceManager, which owns these objects.
     BufferID createBuffer();
@@ -1044,6 +1058,8 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mIsDestroyed;
 
     std::unique_ptr<Framebuffer> mDefaultFramebuffer;
+
+    std::unique_ptr<CallOffloadQueue> mCallOffloadQueue;
 };
 
 class [[nodiscard]] ScopedContextRef
@@ -1073,7 +1089,7 @@ class [[nodiscard]] ScopedContextRef
 extern Context *GetCurrentValidContextTLS();
 extern void SetCurrentValidContextTLS(Context *context);
 #else
-extern thread_local Context *gCurrentValidContext;
+extern thread_local ANGLE_TLS_CONSTINIT Context *gCurrentValidContext;
 #endif
 
 extern void SetCurrentValidContext(Context *context);
@@ -1241,8 +1241,11 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
     mInvalidStreamSet.insert(mStreamSet.begin(), mStreamSet.end());
     mStreamSet.clear();
 
-    mInvalidSurfaceMap.insert(mState.surfaceMap.begin(), mState.surfaceMap.end());
-    mState.surfaceMap.clear();
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mState.surfaceMapMutex);
+        mInvalidSurfaceMap.insert(mState.surfaceMap.begin(), mState.surfaceMap.end());
+        mState.surfaceMap.clear();
+    }
 
     mInvalidSyncMap.insert(std::make_move_iterator(mSyncMap.begin()),
                            std::make_move_iterator(mSyncMap.end()));
@@ -1412,7 +1415,10 @@ Error Display::createWindowSurface(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
-    mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mState.surfaceMapMutex);
+        mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    }
 
     WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
     ASSERT(windowSurfaces && windowSurfaces->find(window) == windowSurfaces->end());
@@ -1442,7 +1448,10 @@ Error Display::createPbufferSurface(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
-    mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mState.surfaceMapMutex);
+        mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    }
 
     return NoError();
 }
@@ -1469,7 +1478,10 @@ Error Display::createPbufferFromClientBuffer(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
-    mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mState.surfaceMapMutex);
+        mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    }
 
     return NoError();
 }
@@ -1495,7 +1507,10 @@ Error Display::createPixmapSurface(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
-    mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mState.surfaceMapMutex);
+        mState.surfaceMap.insert(std::pair((*outSurface)->id().value, *outSurface));
+    }
 
     return NoError();
 }
@@ -1743,7 +1758,7 @@ Error Display::makeCurrent(Thread *thread,
         previousContext->release();
         thread->setCurrent(nullptr);
 
-        auto error = previousContext->unMakeCurrent(this);
+        auto error = previousContext->unMakeCurrent(this, context);
         if (!previousContext->isReferenced() && previousContext->isDestroyed())
         {
             // The previous Context may have been created with a different Display.
@@ -1837,10 +1852,13 @@ Error Display::destroySurfaceImpl(Surface *surface, SurfaceMap *surfaces)
         ASSERT(surfaceRemoved);
     }
 
-    auto iter = surfaces->find(surface->id().value);
-    ASSERT(iter != surfaces->end());
-    mSurfaceHandleAllocator.release(surface->id().value);
-    surfaces->erase(iter);
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mState.surfaceMapMutex);
+        auto iter = surfaces->find(surface->id().value);
+        ASSERT(iter != surfaces->end());
+        mSurfaceHandleAllocator.release(surface->id().value);
+        surfaces->erase(iter);
+    }
     ANGLE_TRY(surface->onDestroy(this));
     return NoError();
 }
@@ -2722,6 +2740,12 @@ const egl::Surface *Display::getSurface(egl::SurfaceID surfaceID) const
     return iter != mState.surfaceMap.end() ? iter->second : nullptr;
 }
 
+const egl::Surface *Display::getSurfaceThreadSafe(egl::SurfaceID surfaceID) const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mState.surfaceMapMutex);
+    return getSurface(surfaceID);
+}
+
 const egl::Image *Display::getImage(egl::ImageID imageID) const
 {
     auto iter = mImageMap.find(imageID.value);
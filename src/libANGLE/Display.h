@@ -84,6 +84,10 @@ struct DisplayState final : private angle::NonCopyable
     ContextMap contextMap;
     mutable angle::SimpleMutex contextMapMutex;
     SurfaceMap surfaceMap;
+    // Protects surfaceMap from lookups done by eglSwapBuffers without the global EGL lock (see
+    // Display::getSurfaceThreadSafe()).  Changes to the map take it in addition to the global EGL
+    // lock.
+    mutable angle::SimpleMutex surfaceMapMutex;
     angle::FeatureOverrides featureOverrides;
     EGLNativeDisplayType displayId;
 
@@ -335,6 +339,10 @@ class Display final : public LabeledObject,
 
     const gl::Context *getContext(gl::ContextID contextID) const;
     const egl::Surface *getSurface(egl::SurfaceID surfaceID) const;
+    // getSurface() for eglSwapBuffers and friends, which may run without the global EGL lock (see
+    // ScopedSwapBuffersLock).  Other lookups hold the global EGL lock, like every change to the
+    // surface map, and don't need DisplayState::surfaceMapMutex.
+    const egl::Surface *getSurfaceThreadSafe(egl::SurfaceID surfaceID) const;
     const egl::Image *getImage(egl::ImageID imageID) const;
     const egl::Sync *getSync(egl::SyncID syncID) const;
     gl::Context *getContext(gl::ContextID contextID);
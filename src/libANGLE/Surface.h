@@ -16,6 +16,7 @@
 #include <EGL/egl.h>
 
 #include "common/PackedEnums.h"
+#include "common/SimpleMutex.h"
 #include "common/angleutils.h"
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Debug.h"
@@ -229,6 +230,11 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
     }
     bool isReferenced() const { return mRefCount > 0; }
 
+    // eglSwapBuffers may not hold the global EGL lock (see ScopedSwapBuffersLock), so swaps are
+    // serialized with queries and attribute changes made to the surface from other threads with
+    // this mutex instead.
+    angle::SimpleMutex &getSwapMutex() { return mSwapMutex; }
+
   protected:
     Surface(EGLint surfaceType,
             SurfaceID id,
@@ -312,6 +318,8 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
     gl::InitState mColorInitState;
     gl::InitState mDepthStencilInitState;
     angle::ObserverBinding mImplObserverBinding;
+
+    angle::SimpleMutex mSwapMutex;
 };
 
 class WindowSurface final : public Surface
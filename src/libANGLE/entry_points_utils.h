@@ -15,6 +15,7 @@
 #include "common/angleutils.h"
 #include "common/entry_points_enum_autogen.h"
 #include "common/mathutil.h"
+#include "libANGLE/CallOffloadQueue.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 
@@ -102,6 +103,22 @@ inline int CID(const Context *context)
 {
     return context == nullptr ? 0 : static_cast<int>(context->id().value);
 }
+
+// Hands a call to the context's offload thread, see Context::offloadCall.  The offload thread
+// replays calls through their entry points, which then execute them.
+template <typename... FuncParams, typename... Params>
+ANGLE_INLINE bool OffloadCall(Context *context,
+                              angle::EntryPoint entryPoint,
+                              bool paramsCanBeOffloaded,
+                              void(GL_APIENTRY *func)(FuncParams...),
+                              Params... params)
+{
+    if (CallOffloadQueue::IsOffloadThread())
+    {
+        return false;
+    }
+    return context->offloadCall(OffloadedCall(entryPoint, paramsCanBeOffloaded, func, params...));
+}
 }  // namespace gl
 
 namespace egl
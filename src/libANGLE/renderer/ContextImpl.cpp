@@ -44,6 +44,11 @@ angle::Result ContextImpl::onUnMakeCurrent(const gl::Context *context)
     return angle::Result::Continue;
 }
 
+angle::Result ContextImpl::onUnMakeCurrentForShareGroupSwitch(const gl::Context *context)
+{
+    return onUnMakeCurrent(context);
+}
+
 angle::Result ContextImpl::handleNoopDrawEvent()
 {
     return angle::Result::Continue;
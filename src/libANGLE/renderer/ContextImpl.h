@@ -225,6 +225,9 @@ class ContextImpl : public GLImplFactory
     // Context switching
     virtual angle::Result onMakeCurrent(const gl::Context *context) = 0;
     virtual angle::Result onUnMakeCurrent(const gl::Context *context);
+    // Called instead of onUnMakeCurrent when the thread makes another context of the same share
+    // group current next.
+    virtual angle::Result onUnMakeCurrentForShareGroupSwitch(const gl::Context *context);
 
     // Native capabilities, unmodified by gl::Context.
     virtual gl::Caps getNativeCaps() const                                              = 0;
@@ -2724,6 +2724,10 @@ void InitializeFrontendFeatures(const FunctionsGL *functions, angle::FrontendFea
     ANGLE_FEATURE_CONDITION(features, compileJobIsThreadSafe, false);
     ANGLE_FEATURE_CONDITION(features, linkJobIsThreadSafe, false);
 
+    // For the same reason, GL calls cannot be executed on a thread the native context is not
+    // current on.
+    ANGLE_FEATURE_CONDITION(features, offloadGlCallsToWorkerThread, false);
+
     ANGLE_FEATURE_CONDITION(features, cacheCompiledShader, true);
 }
 
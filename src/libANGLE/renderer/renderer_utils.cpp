@@ -24,6 +24,7 @@
 #include "libANGLE/renderer/Format.h"
 #include "platform/Feature.h"
 
+#include <array>
 #include <cctype>
 #include <cstring>
 
@@ -139,6 +140,10 @@ namespace rx
 
 namespace
 {
+// Matrix uniform updates up to this size are compared against the shadow copy of the default
+// uniform block, so that redundant updates don't dirty it.  That's four mat4s.
+constexpr size_t kMaxComparedMatrixUniformSize = 256;
+
 // Both D3D and Vulkan support the same set of standard sample positions for 1, 2, 4, 8, and 16
 // samples.  See:
 //
@@ -1041,7 +1046,7 @@ BufferAndLayout::BufferAndLayout() = default;
 BufferAndLayout::~BufferAndLayout() = default;
 
 template <typename T>
-ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
+ANGLE_NOINLINE bool UpdateBufferWithLayoutStrided(GLsizei count,
                                                   uint32_t arrayIndex,
                                                   int componentCount,
                                                   const T *v,
@@ -1051,6 +1056,7 @@ ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
     const int elementSize = sizeof(T) * componentCount;
     uint8_t *dst          = uniformData->data() + layoutInfo.offset;
     int maxIndex          = arrayIndex + count;
+    bool changed          = false;
     for (int writeIndex = arrayIndex, readIndex = 0; writeIndex < maxIndex;
          writeIndex++, readIndex++)
     {
@@ -1058,12 +1064,19 @@ ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
         uint8_t *writePtr     = dst + arrayOffset;
         const T *readPtr      = v + (readIndex * componentCount);
         ASSERT(writePtr + elementSize <= uniformData->data() + uniformData->size());
-        memcpy(writePtr, readPtr, elementSize);
+        if (memcmp(writePtr, readPtr, elementSize) != 0)
+        {
+            memcpy(writePtr, readPtr, elementSize);
+            changed = true;
+        }
     }
+    return changed;
 }
 
+// Returns whether the shadow copy of the uniform changed.  Applications commonly set uniforms to
+// the values they already have, and those updates should not cause the block to be re-uploaded.
 template <typename T>
-ANGLE_INLINE void UpdateBufferWithLayout(GLsizei count,
+ANGLE_INLINE bool UpdateBufferWithLayout(GLsizei count,
                                          uint32_t arrayIndex,
                                          int componentCount,
                                          const T *v,
@@ -1078,13 +1091,18 @@ ANGLE_INLINE void UpdateBufferWithLayout(GLsizei count,
         uint32_t arrayOffset = arrayIndex * layoutInfo.arrayStride;
         uint8_t *writePtr    = dst + arrayOffset;
         ASSERT(writePtr + (elementSize * count) <= uniformData->data() + uniformData->size());
+        if (memcmp(writePtr, v, elementSize * count) == 0)
+        {
+            return false;
+        }
         memcpy(writePtr, v, elementSize * count);
+        return true;
     }
     else
     {
         // Have to respect the arrayStride between each element of the array.
-        UpdateBufferWithLayoutStrided(count, arrayIndex, componentCount, v, layoutInfo,
-                                      uniformData);
+        return UpdateBufferWithLayoutStrided(count, arrayIndex, componentCount, v, layoutInfo,
+                                             uniformData);
     }
 }
 
@@ -1151,11 +1169,14 @@ ANGLE_NOINLINE void SetUniformAsBool(const gl::ProgramExecutable *executable,
 
             for (int c = 0; c < componentCount; c++)
             {
-                dst[c] = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                const GLint value = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                if (dst[c] != value)
+                {
+                    dst[c] = value;
+                    defaultUniformBlocksDirty->set(shaderType);
+                }
             }
         }
-
-        defaultUniformBlocksDirty->set(shaderType);
     }
 }
 
@@ -1187,9 +1208,11 @@ void SetUniform(const gl::ProgramExecutable *executable,
             }
 
             const GLint componentCount = linkedUniform.getElementComponents();
-            UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v, layoutInfo,
-                                   &uniformBlock.uniformData);
-            defaultUniformBlocksDirty->set(shaderType);
+            if (UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v,
+                                       layoutInfo, &uniformBlock.uniformData))
+            {
+                defaultUniformBlocksDirty->set(shaderType);
+            }
         }
     }
     else
@@ -1243,11 +1266,31 @@ void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
             continue;
         }
 
-        SetFloatUniformMatrixGLSL<cols, rows>::Run(
-            locationInfo.arrayIndex, linkedUniform.getBasicTypeElementCount(), count, transpose,
-            value, uniformBlock.uniformData.data() + layoutInfo.offset);
+        // GLSL matrices are stored column-major with each column padded to a vec4.  For the
+        // common case of a few matrices, keep the previous contents to tell whether the update
+        // changed anything.
+        constexpr size_t kMatrixSize    = sizeof(GLfloat) * cols * 4;
+        const unsigned int elementCount = linkedUniform.getBasicTypeElementCount();
+        const size_t writeCount =
+            std::min(elementCount - locationInfo.arrayIndex, static_cast<unsigned int>(count));
+        const size_t writeSize = writeCount * kMatrixSize;
+        uint8_t *blockData     = uniformBlock.uniformData.data() + layoutInfo.offset;
+        uint8_t *writePtr      = blockData + locationInfo.arrayIndex * kMatrixSize;
+
+        std::array<uint8_t, kMaxComparedMatrixUniformSize> previousData;
+        const bool compare = writeSize <= previousData.size();
+        if (compare)
+        {
+            memcpy(previousData.data(), writePtr, writeSize);
+        }
 
-        defaultUniformBlocksDirty->set(shaderType);
+        SetFloatUniformMatrixGLSL<cols, rows>::Run(locationInfo.arrayIndex, elementCount, count,
+                                                   transpose, value, blockData);
+
+        if (!compare || memcmp(previousData.data(), writePtr, writeSize) != 0)
+        {
+            defaultUniformBlocksDirty->set(shaderType);
+        }
     }
 }
 
@@ -288,8 +288,9 @@ struct BufferAndLayout final : private angle::NonCopyable
     std::vector<sh::BlockMemberInfo> uniformLayout;
 };
 
+// Returns whether the shadow copy changed.
 template <typename T>
-void UpdateBufferWithLayout(GLsizei count,
+bool UpdateBufferWithLayout(GLsizei count,
                             uint32_t arrayIndex,
                             int componentCount,
                             const T *v,
@@ -61,6 +61,9 @@ static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be pow
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
 
+// Stop speculatively reading back a buffer after this many copies in a row were not mapped.
+constexpr uint32_t kMaxUnusedSpeculativeReadbacks = 4;
+
 // Buffers that have a static usage pattern will be allocated in
 // device local memory to speed up access to and from the GPU.
 // Dynamic usage patterns or that are frequently mapped
@@ -376,7 +379,11 @@ BufferVk::BufferVk(const gl::BufferState &state)
       mIsStagingBufferMapped(false),
       mHasValidData(false),
       mIsMappedForWrite(false),
-      mUsageType(BufferUsageType::Static)
+      mUsageType(BufferUsageType::Static),
+      mIsReadbackBufferMapped(false),
+      mIsReadbackBufferUsed(false),
+      mIsReadbackPredicted(false),
+      mUnusedReadbackCount(0)
 {
     mMappedRange.invalidate();
 }
@@ -387,6 +394,12 @@ void BufferVk::destroy(const gl::Context *context)
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
+    if (mIsReadbackPredicted)
+    {
+        contextVk->getShareGroup()->onBufferReadbackNotPredicted(this);
+        mIsReadbackPredicted = false;
+    }
+
     (void)release(contextVk);
 }
 
@@ -409,6 +422,10 @@ angle::Result BufferVk::release(ContextVk *contextVk)
     {
         mStagingBuffer.release(contextVk);
     }
+    if (mReadbackBuffer.valid())
+    {
+        mReadbackBuffer.release(contextVk);
+    }
 
     releaseConversionBuffers(contextVk);
 
@@ -673,6 +690,92 @@ angle::Result BufferVk::handleDeviceLocalBufferMap(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+void BufferVk::predictReadback(ContextVk *contextVk)
+{
+    mUnusedReadbackCount = 0;
+
+    if (!mIsReadbackPredicted)
+    {
+        contextVk->getShareGroup()->onBufferReadbackPredicted(this);
+        mIsReadbackPredicted = true;
+    }
+}
+
+bool BufferVk::isSpeculativeReadbackValid() const
+{
+    return mReadbackBuffer.valid() && mReadbackSourceSerial == mBuffer.getBufferSerial() &&
+           mReadbackSourceWriteUse.getSerials() == mBuffer.getWriteResourceUse().getSerials();
+}
+
+angle::Result BufferVk::recordSpeculativeReadback(ContextVk *contextVk, bool *keepPredictingOut)
+{
+    *keepPredictingOut = true;
+
+    // Only copy if the commands about to be submitted write to the buffer, and only once after the
+    // last write.  A mapped copy is left alone until it is unmapped.
+    if (!mBuffer.valid() || mBuffer.isHostVisible() || isExternalBuffer() ||
+        mIsReadbackBufferMapped ||
+        !contextVk->hasUnsubmittedUseInThisContext(mBuffer.getWriteResourceUse()) ||
+        isSpeculativeReadbackValid())
+    {
+        return angle::Result::Continue;
+    }
+
+    if (mReadbackBuffer.valid() && !mIsReadbackBufferUsed)
+    {
+        if (++mUnusedReadbackCount >= kMaxUnusedSpeculativeReadbacks)
+        {
+            // The buffer is no longer read back; stop copying it.
+            mReadbackBuffer.release(contextVk);
+            mIsReadbackPredicted = false;
+            *keepPredictingOut   = false;
+            return angle::Result::Continue;
+        }
+    }
+
+    const VkDeviceSize size = static_cast<VkDeviceSize>(mState.getSize());
+    if (mReadbackBuffer.valid() && mReadbackBuffer.getSize() < size)
+    {
+        mReadbackBuffer.release(contextVk);
+    }
+    if (!mReadbackBuffer.valid())
+    {
+        ANGLE_TRY(contextVk->initBufferForBufferCopy(&mReadbackBuffer, static_cast<size_t>(size),
+                                                     vk::MemoryCoherency::CachedPreferCoherent));
+    }
+
+    // The copy is ordered after any previous copy to mReadbackBuffer on the GPU, and the CPU only
+    // reads it after waiting for its latest use, so it can be reused while still in use.
+    VkBufferCopy copyRegion = {mBuffer.getOffset(), mReadbackBuffer.getOffset(), size};
+    ANGLE_TRY(CopyBuffers(contextVk, &mBuffer, &mReadbackBuffer, 1, &copyRegion));
+
+    mReadbackSourceSerial   = mBuffer.getBufferSerial();
+    mReadbackSourceWriteUse = mBuffer.getWriteResourceUse();
+    mIsReadbackBufferUsed   = false;
+
+    return angle::Result::Continue;
+}
+
+angle::Result BufferVk::mapSpeculativeReadback(ContextVk *contextVk,
+                                               VkDeviceSize offset,
+                                               uint8_t **mapPtr)
+{
+    ASSERT(isSpeculativeReadbackValid());
+    ASSERT(!mIsReadbackBufferMapped);
+
+    // Usually the copy has already finished, or at least been submitted along with the writes the
+    // caller has just waited for.
+    ANGLE_TRY(mReadbackBuffer.waitForIdle(contextVk, nullptr,
+                                          RenderPassClosureReason::DeviceLocalBufferMap));
+    ANGLE_TRY(mReadbackBuffer.invalidate(contextVk->getRenderer()));
+
+    *mapPtr                 = mReadbackBuffer.getMappedMemory() + offset;
+    mIsReadbackBufferMapped = true;
+    mIsReadbackBufferUsed   = true;
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferVk::mapHostVisibleBuffer(ContextVk *contextVk,
                                              VkDeviceSize offset,
                                              GLbitfield access,
@@ -806,6 +909,16 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
     // Read case
     if ((access & GL_MAP_WRITE_BIT) == 0)
     {
+        // Device local buffers that are read back are copied to host cached memory when they are
+        // written to.  Predicting before the flush below lets that flush already record the copy.
+        const bool speculativeReadback =
+            !hostVisible && !isExternalBuffer() &&
+            contextVk->getFeatures().speculativeReadbackForDeviceLocalBuffers.enabled;
+        if (speculativeReadback)
+        {
+            predictReadback(contextVk);
+        }
+
         // If app is not going to write, all we need is to ensure GPU write is finished.
         // Concurrent reads from CPU and GPU is allowed.
         if (!renderer->hasResourceUseFinished(mBuffer.getWriteResourceUse()))
@@ -822,6 +935,10 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
         {
             return mapHostVisibleBuffer(contextVk, offset, access, mapPtrBytes);
         }
+        if (speculativeReadback && isSpeculativeReadbackValid())
+        {
+            return mapSpeculativeReadback(contextVk, offset, mapPtrBytes);
+        }
         return handleDeviceLocalBufferMap(contextVk, offset, length, mapPtrBytes);
     }
 
@@ -894,7 +1011,13 @@ angle::Result BufferVk::unmapImpl(ContextVk *contextVk, BufferFeedback *feedback
 {
     ASSERT(mBuffer.valid());
 
-    if (mIsStagingBufferMapped)
+    if (mIsReadbackBufferMapped)
+    {
+        // The speculative readback copy is only ever mapped for reading.
+        ASSERT(!mIsMappedForWrite);
+        mIsReadbackBufferMapped = false;
+    }
+    else if (mIsStagingBufferMapped)
     {
         ASSERT(mStagingBuffer.valid());
         // The buffer is device local or optimization of small range map.
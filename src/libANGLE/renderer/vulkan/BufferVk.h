@@ -274,6 +274,12 @@ class BufferVk : public BufferImpl
         vk::Renderer *renderer,
         const VertexConversionBuffer::CacheKey &cacheKey);
 
+    // Called right before the commands of |contextVk| are submitted, if the buffer is predicted to
+    // be mapped for reading.  If those commands write to the buffer, a copy of it to host cached
+    // memory is recorded so the next map doesn't have to.  |keepPredictingOut| is set to false
+    // once enough copies went unused.
+    angle::Result recordSpeculativeReadback(ContextVk *contextVk, bool *keepPredictingOut);
+
   private:
     angle::Result updateBuffer(ContextVk *contextVk,
                                size_t bufferSize,
@@ -315,6 +321,11 @@ class BufferVk : public BufferImpl
                                        VkDeviceSize offset,
                                        GLbitfield access,
                                        uint8_t **mapPtr);
+    void predictReadback(ContextVk *contextVk);
+    bool isSpeculativeReadbackValid() const;
+    angle::Result mapSpeculativeReadback(ContextVk *contextVk,
+                                         VkDeviceSize offset,
+                                         uint8_t **mapPtr);
     angle::Result setDataImpl(ContextVk *contextVk,
                               size_t bufferSize,
                               const BufferDataSource &dataSource,
@@ -383,6 +394,20 @@ class BufferVk : public BufferImpl
     // Similar as mIsMappedForWrite, this maybe different from mState's getMapOffset/getMapLength if
     // mapped from angle internal.
     RangeDeviceSize mMappedRange;
+
+    // A host cached copy of the whole buffer, recorded speculatively after the GPU writes to a
+    // device local buffer that is being read back.  It can be mapped instead of mBuffer as long as
+    // mBuffer has not been replaced or written to since the copy.
+    vk::BufferHelper mReadbackBuffer;
+    vk::BufferSerial mReadbackSourceSerial;
+    vk::ResourceUse mReadbackSourceWriteUse;
+    bool mIsReadbackBufferMapped;
+    // Whether the current copy in mReadbackBuffer has been mapped.
+    bool mIsReadbackBufferUsed;
+    // Whether the buffer is registered with the share group for speculative readback, and how
+    // many speculative copies in a row went unused.
+    bool mIsReadbackPredicted;
+    uint32_t mUnusedReadbackCount;
 };
 
 }  // namespace rx
@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/vulkan/CommandQueue.h"
 #include <algorithm>
+#include <array>
 #include "common/system_utils.h"
 #include "libANGLE/renderer/vulkan/SyncVk.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
@@ -146,9 +147,76 @@ void FenceRecycler::recycle(Fence &&fence)
     mRecycler.recycle(std::move(fence));
 }
 
+// QueueTimeline implementation.
+QueueTimeline::QueueTimeline() : mLastAllocatedValue(0), mLastCompletedValue(0) {}
+
+QueueTimeline::~QueueTimeline()
+{
+    ASSERT(!valid());
+}
+
+VkResult QueueTimeline::init(VkDevice device)
+{
+    mLastAllocatedValue = 0;
+    mLastCompletedValue = 0;
+    return mSemaphore.initTimeline(device, 0);
+}
+
+void QueueTimeline::destroy(VkDevice device)
+{
+    mSemaphore.destroy(device);
+}
+
+VkResult QueueTimeline::getStatus(VkDevice device, uint64_t value) const
+{
+    if (value <= mLastCompletedValue.load(std::memory_order_acquire))
+    {
+        return VK_SUCCESS;
+    }
+
+    uint64_t counterValue = 0;
+    const VkResult result = mSemaphore.getCounterValue(device, &counterValue);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    onValueCompleted(counterValue);
+    return value <= counterValue ? VK_SUCCESS : VK_NOT_READY;
+}
+
+VkResult QueueTimeline::wait(VkDevice device, uint64_t value, uint64_t timeout) const
+{
+    if (value <= mLastCompletedValue.load(std::memory_order_acquire))
+    {
+        return VK_SUCCESS;
+    }
+
+    const VkResult result = mSemaphore.wait(device, value, timeout);
+    if (result == VK_SUCCESS)
+    {
+        onValueCompleted(value);
+    }
+    return result;
+}
+
+void QueueTimeline::onValueCompleted(uint64_t value) const
+{
+    // Other threads may have seen a larger value in the meantime; never move backwards.
+    uint64_t lastCompletedValue = mLastCompletedValue.load(std::memory_order_relaxed);
+    while (value > lastCompletedValue &&
+           !mLastCompletedValue.compare_exchange_weak(
+               lastCompletedValue, value, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
 // CommandBatch implementation.
 CommandBatch::CommandBatch()
-    : mProtectionType(ProtectionType::InvalidEnum), mCommandPoolAccess(nullptr)
+    : mProtectionType(ProtectionType::InvalidEnum),
+      mCommandPoolAccess(nullptr),
+      mTimeline(nullptr),
+      mTimelineValue(0)
 {}
 
 CommandBatch::~CommandBatch() = default;
@@ -167,6 +235,8 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
     std::swap(mSecondaryCommands, other.mSecondaryCommands);
     std::swap(mFence, other.mFence);
     std::swap(mExternalFence, other.mExternalFence);
+    std::swap(mTimeline, other.mTimeline);
+    std::swap(mTimelineValue, other.mTimelineValue);
     return *this;
 }
 
@@ -253,6 +323,14 @@ void CommandBatch::setExternalFence(SharedExternalFence &&externalFence)
     mExternalFence = std::move(externalFence);
 }
 
+void CommandBatch::setTimelineSignal(const QueueTimeline *timeline, uint64_t value)
+{
+    ASSERT(timeline != nullptr && timeline->valid());
+    ASSERT(mTimeline == nullptr);
+    mTimeline      = timeline;
+    mTimelineValue = value;
+}
+
 const QueueSerial &CommandBatch::getQueueSerial() const
 {
     ASSERT(mQueueSerial.valid());
@@ -272,24 +350,32 @@ const SharedExternalFence &CommandBatch::getExternalFence()
 bool CommandBatch::hasFence() const
 {
     ASSERT(!mFence || mFence->valid());
-    return mFence || mExternalFence;
+    return mTimeline != nullptr || mFence || mExternalFence;
 }
 
 VkFence CommandBatch::getFenceHandle() const
 {
-    ASSERT(hasFence());
+    ASSERT(mFence || mExternalFence);
     return mFence ? mFence->get().getHandle() : mExternalFence->getHandle();
 }
 
 VkResult CommandBatch::getFenceStatus(VkDevice device) const
 {
     ASSERT(hasFence());
+    if (mTimeline != nullptr)
+    {
+        return mTimeline->getStatus(device, mTimelineValue);
+    }
     return mFence ? mFence->get().getStatus(device) : mExternalFence->getStatus(device);
 }
 
 VkResult CommandBatch::waitFence(VkDevice device, uint64_t timeout) const
 {
     ASSERT(hasFence());
+    if (mTimeline != nullptr)
+    {
+        return mTimeline->wait(device, mTimelineValue, timeout);
+    }
     return mFence ? mFence->get().wait(device, timeout) : mExternalFence->wait(device, timeout);
 }
 
@@ -301,7 +387,16 @@ VkResult CommandBatch::waitFenceUnlocked(VkDevice device,
     VkResult status;
     // You can only use the local copy of the fence without lock.
     // Do not access "this" after unlock() because object might be deleted from other thread.
-    if (mFence)
+    if (mTimeline != nullptr)
+    {
+        // The timeline itself is owned by the CommandQueue and stays alive.
+        const QueueTimeline *timeline = mTimeline;
+        const uint64_t value          = mTimelineValue;
+        lock->unlock();
+        status = timeline->wait(device, value, timeout);
+        lock->lock();
+    }
+    else if (mFence)
     {
         const SharedFence localFenceToWaitOn = mFence;
         lock->unlock();
@@ -458,6 +553,250 @@ void CleanUpThread::destroy(ErrorContext *context)
     }
 }
 
+// QueueSubmitThread implementation.
+void QueueSubmitThread::handleError(VkResult errorCode,
+                                    const char *file,
+                                    const char *function,
+                                    unsigned int line)
+{
+    ASSERT(errorCode != VK_SUCCESS);
+
+    std::stringstream errorStream;
+    errorStream << "Internal Vulkan error (" << errorCode << "): " << VulkanResultString(errorCode)
+                << ".";
+    WARN() << errorStream.str();
+
+    // The batch that failed is dropped, but it already counts as submitted, so processTasks()
+    // treats the failure as device loss.  The context that picks up the error in
+    // checkAndPopPendingError() is told so.
+    std::lock_guard<angle::SimpleMutex> queueLock(mErrorMutex);
+    Error error = {VK_ERROR_DEVICE_LOST, file, function, line};
+    mErrors.emplace(error);
+}
+
+QueueSubmitThread::QueueSubmitThread(Renderer *renderer, CommandQueue *commandQueue)
+    : ErrorContext(renderer), mCommandQueue(commandQueue), mTaskThreadShouldExit(false)
+{}
+
+QueueSubmitThread::~QueueSubmitThread() = default;
+
+angle::Result QueueSubmitThread::checkAndPopPendingError(ErrorContext *errorHandlingContext)
+{
+    std::lock_guard<angle::SimpleMutex> queueLock(mErrorMutex);
+    if (mErrors.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    while (!mErrors.empty())
+    {
+        Error err = mErrors.front();
+        mErrors.pop();
+        errorHandlingContext->handleError(err.errorCode, err.file, err.function, err.line);
+    }
+    return angle::Result::Stop;
+}
+
+void QueueSubmitThread::requestSubmit()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mWorkAvailableCondition.notify_one();
+}
+
+void QueueSubmitThread::processTasks()
+{
+    angle::SetCurrentThreadName("ANGLE-Submit");
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mWorkAvailableCondition.wait(lock, [this] {
+            return mTaskThreadShouldExit || mCommandQueue->hasPendingSubmissions();
+        });
+
+        if (mTaskThreadShouldExit)
+        {
+            break;
+        }
+        lock.unlock();
+
+        // Errors are raised with mQueueMutex held, so the device loss is handled here.  This also
+        // drops the batches behind the failed one, and marks them all finished so that no one
+        // waits for them.
+        if (mCommandQueue->submitPendingBatches(this) == angle::Result::Stop)
+        {
+            mCommandQueue->handleDeviceLost(mRenderer);
+        }
+
+        lock.lock();
+    }
+}
+
+angle::Result QueueSubmitThread::init()
+{
+    mTaskThread = std::thread(&QueueSubmitThread::processTasks, this);
+
+    return angle::Result::Continue;
+}
+
+void QueueSubmitThread::destroy(ErrorContext *context)
+{
+    {
+        // Request to terminate the worker thread
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTaskThreadShouldExit = true;
+        mWorkAvailableCondition.notify_one();
+    }
+
+    if (mTaskThread.joinable())
+    {
+        mTaskThread.join();
+    }
+
+    // Submit anything the thread did not get to.
+    (void)mCommandQueue->submitPendingBatches(context);
+    (void)checkAndPopPendingError(context);
+}
+
+// RenderPassReplayThread implementation.
+void RenderPassReplayThread::handleError(VkResult errorCode,
+                                         const char *file,
+                                         const char *function,
+                                         unsigned int line)
+{
+    ASSERT(errorCode != VK_SUCCESS);
+
+    std::stringstream errorStream;
+    errorStream << "Internal Vulkan error (" << errorCode << "): " << VulkanResultString(errorCode)
+                << ".";
+
+    if (errorCode == VK_ERROR_DEVICE_LOST)
+    {
+        WARN() << errorStream.str();
+        mCommandQueue->handleDeviceLost(mRenderer);
+    }
+
+    std::lock_guard<angle::SimpleMutex> queueLock(mErrorMutex);
+    Error error = {errorCode, file, function, line};
+    mErrors.emplace(error);
+}
+
+RenderPassReplayThread::RenderPassReplayThread(Renderer *renderer, CommandQueue *commandQueue)
+    : ErrorContext(renderer),
+      mCommandQueue(commandQueue),
+      mTaskThreadShouldExit(false),
+      mIsReplaying(false)
+{}
+
+RenderPassReplayThread::~RenderPassReplayThread() = default;
+
+angle::Result RenderPassReplayThread::checkAndPopPendingError(ErrorContext *errorHandlingContext)
+{
+    std::lock_guard<angle::SimpleMutex> queueLock(mErrorMutex);
+    if (mErrors.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    while (!mErrors.empty())
+    {
+        Error err = mErrors.front();
+        mErrors.pop();
+        errorHandlingContext->handleError(err.errorCode, err.file, err.function, err.line);
+    }
+    return angle::Result::Stop;
+}
+
+void RenderPassReplayThread::enqueue(const RenderPassReplayTask &task)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ASSERT(!mTaskThreadShouldExit);
+    mTasks.push(task);
+    mWorkAvailableCondition.notify_one();
+}
+
+angle::Result RenderPassReplayThread::waitIdle(ErrorContext *context)
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWorkDoneCondition.wait(lock, [this] { return mTasks.empty() && !mIsReplaying; });
+    }
+
+    return checkAndPopPendingError(context);
+}
+
+void RenderPassReplayThread::processTasks()
+{
+    angle::SetCurrentThreadName("ANGLE-Replay");
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mWorkAvailableCondition.wait(lock,
+                                     [this] { return mTaskThreadShouldExit || !mTasks.empty(); });
+
+        // On exit, finish replaying whatever is left so no recorded commands are lost.
+        if (mTasks.empty())
+        {
+            break;
+        }
+
+        RenderPassReplayTask task = mTasks.front();
+        mTasks.pop();
+        mIsReplaying = true;
+        lock.unlock();
+
+        if (mCommandQueue->replayRenderPassCommands(this, task) != angle::Result::Continue)
+        {
+            // The failed replay did not reset the helper, so do it here to recycle it as on
+            // success.  The error is reported to the context on the next waitIdle().
+            SecondaryCommandBufferCollector commandBufferCollector;
+            angle::Result resetResult =
+                task.renderPassCommands->reset(this, &commandBufferCollector);
+            commandBufferCollector.releaseCommandBuffers();
+
+            if (resetResult != angle::Result::Continue)
+            {
+                // The helper could not get a new command buffer and cannot be used again.
+                SafeDelete(task.renderPassCommands);
+            }
+        }
+
+        if (task.renderPassCommands != nullptr)
+        {
+            mRenderer->recycleRenderPassCommandBufferHelper(&task.renderPassCommands);
+        }
+
+        lock.lock();
+        mIsReplaying = false;
+        mWorkDoneCondition.notify_all();
+    }
+}
+
+angle::Result RenderPassReplayThread::init()
+{
+    mTaskThread = std::thread(&RenderPassReplayThread::processTasks, this);
+
+    return angle::Result::Continue;
+}
+
+void RenderPassReplayThread::destroy(ErrorContext *context)
+{
+    {
+        // Request to terminate the worker thread
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTaskThreadShouldExit = true;
+        mWorkAvailableCondition.notify_one();
+    }
+
+    if (mTaskThread.joinable())
+    {
+        mTaskThread.join();
+    }
+
+    (void)checkAndPopPendingError(context);
+}
+
 CommandPoolAccess::CommandPoolAccess()  = default;
 CommandPoolAccess::~CommandPoolAccess() = default;
 
@@ -541,6 +880,24 @@ angle::Result CommandPoolAccess::flushRenderPassCommands(
     return (*renderPassCommands)->flushToPrimary(context, &state, renderPass, framebufferOverride);
 }
 
+angle::Result CommandPoolAccess::replayRenderPassCommands(ErrorContext *context,
+                                                          const RenderPassReplayTask &task)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mCmdPoolMutex);
+    ANGLE_TRY(ensurePrimaryCommandBufferValidLocked(context, task.protectionType, task.priority));
+    CommandsState &state = mCommandsStateMap[task.priority][task.protectionType];
+
+    // The render pass object itself is owned by the context's render pass cache, and is only
+    // released to the garbage list (which outlives the submission) when that cache is cleared.
+    RenderPass renderPass;
+    renderPass.setHandle(task.renderPass);
+    angle::Result result = task.renderPassCommands->flushToPrimary(context, &state, renderPass,
+                                                                   task.framebufferOverride);
+    renderPass.release();
+
+    return result;
+}
+
 void CommandPoolAccess::flushWaitSemaphores(
     ProtectionType protectionType,
     egl::ContextPriority priority,
@@ -614,7 +971,10 @@ angle::Result CommandPoolAccess::getCommandsAndWaitSemaphores(
 CommandQueue::CommandQueue()
     : mInFlightCommands(kInFlightCommandsLimit),
       mFinishedCommandBatches(kMaxFinishedCommandsLimit),
+      mPendingSubmissions(kPendingSubmissionsLimit),
       mNumAllCommands(0),
+      mUseTimelineSemaphores(false),
+      mPriorityTimelines{},
       mPerfCounters{}
 {}
 
@@ -623,6 +983,7 @@ CommandQueue::~CommandQueue() = default;
 void CommandQueue::destroy(ErrorContext *context)
 {
     std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
+    std::lock_guard<angle::SimpleMutex> queueLock(mQueueMutex);
     std::lock_guard<angle::SimpleMutex> cmdCompleteLock(mCmdCompleteMutex);
     std::lock_guard<angle::SimpleMutex> cmdReleaseLock(mCmdReleaseMutex);
 
@@ -635,6 +996,14 @@ void CommandQueue::destroy(ErrorContext *context)
 
     mFenceRecycler.destroy(context);
 
+    // The queues are idle after mQueueMap.destroy().
+    for (QueueTimeline &timeline : mQueueTimelines)
+    {
+        timeline.destroy(context->getDevice());
+    }
+    mUseTimelineSemaphores = false;
+
+    ASSERT(mPendingSubmissions.empty());
     ASSERT(mInFlightCommands.empty());
     ASSERT(mFinishedCommandBatches.empty());
     ASSERT(mNumAllCommands == 0);
@@ -646,11 +1015,13 @@ angle::Result CommandQueue::init(ErrorContext *context,
                                  uint32_t queueCount)
 {
     std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
+    std::lock_guard<angle::SimpleMutex> queueLock(mQueueMutex);
     std::lock_guard<angle::SimpleMutex> cmdCompleteLock(mCmdCompleteMutex);
     std::lock_guard<angle::SimpleMutex> cmdReleaseLock(mCmdReleaseMutex);
 
     // In case Renderer gets re-initialized, we can't rely on constructor to do initialization.
     mLastSubmittedSerials.fill(kZeroSerial);
+    mLastFlushedSerials.fill(kZeroSerial);
     mLastCompletedSerials.fill(kZeroSerial);
 
     // Assign before initializing the command pools in order to get the queue family index.
@@ -663,6 +1034,35 @@ angle::Result CommandQueue::init(ErrorContext *context,
         ANGLE_TRY(mCommandPoolAccess.initCommandPool(context, ProtectionType::Protected,
                                                      mQueueMap.getQueueFamilyIndex()));
     }
+
+    mUseTimelineSemaphores = context->getFeatures().supportsTimelineSemaphore.enabled &&
+                             context->getFeatures().useTimelineSemaphoreForSubmissions.enabled;
+    if (mUseTimelineSemaphores)
+    {
+        for (egl::ContextPriority priority : angle::AllEnums<egl::ContextPriority>())
+        {
+            QueueTimeline *timeline = &mQueueTimelines[priority];
+            for (egl::ContextPriority otherPriority : angle::AllEnums<egl::ContextPriority>())
+            {
+                if (otherPriority == priority)
+                {
+                    break;
+                }
+                if (getQueue(otherPriority) == getQueue(priority))
+                {
+                    timeline = mPriorityTimelines[otherPriority];
+                    break;
+                }
+            }
+
+            if (!timeline->valid())
+            {
+                ANGLE_VK_TRY(context, timeline->init(context->getDevice()));
+            }
+            mPriorityTimelines[priority] = timeline;
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -672,6 +1072,7 @@ void CommandQueue::handleDeviceLost(Renderer *renderer)
     VkDevice device = renderer->getDevice();
     // Hold all locks while clean up mInFlightCommands.
     std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
+    std::lock_guard<angle::SimpleMutex> queueLock(mQueueMutex);
     std::lock_guard<angle::SimpleMutex> cmdCompleteLock(mCmdCompleteMutex);
     std::lock_guard<angle::SimpleMutex> cmdReleaseLock(mCmdReleaseMutex);
 
@@ -692,6 +1093,15 @@ void CommandQueue::handleDeviceLost(Renderer *renderer)
         batch.destroy(device);
         popInFlightBatchLocked();
     }
+
+    // Batches that never made it to the VkQueue are dropped the same way.
+    while (!mPendingSubmissions.empty())
+    {
+        CommandBatch &batch = mPendingSubmissions.front().batch;
+        mLastCompletedSerials.setQueueSerial(batch.getQueueSerial());
+        batch.destroy(device);
+        mPendingSubmissions.pop();
+    }
 }
 
 angle::Result CommandQueue::postSubmitCheck(ErrorContext *context)
@@ -730,6 +1140,12 @@ angle::Result CommandQueue::finishResourceUse(ErrorContext *context,
                                               const ResourceUse &use,
                                               uint64_t timeout)
 {
+    // |use| may need batches that are still pending for the QueueSubmitThread.
+    if (!(use <= mLastSubmittedSerials))
+    {
+        ANGLE_TRY(submitPendingBatches(context));
+    }
+
     VkDevice device = context->getDevice();
     {
         std::unique_lock<angle::SimpleMutex> lock(mCmdCompleteMutex);
@@ -739,8 +1155,7 @@ angle::Result CommandQueue::finishResourceUse(ErrorContext *context,
             ANGLE_TRY(checkOneCommandBatchLocked(context, &finished));
             if (!finished)
             {
-                ANGLE_VK_TRY(context,
-                             mInFlightCommands.front().waitFenceUnlocked(device, timeout, &lock));
+                ANGLE_VK_TRY(context, waitForResourceUseUnlocked(device, use, timeout, &lock));
             }
         }
         // Check the rest of the commands in case they are also finished.
@@ -769,7 +1184,8 @@ angle::Result CommandQueue::waitIdle(ErrorContext *context, uint64_t timeout)
     // Fill the local variable with lock
     ResourceUse use;
     {
-        std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
+        std::lock_guard<angle::SimpleMutex> lock(mQueueMutex);
+        ANGLE_TRY(submitPendingBatchesLocked(context));
         if (mInFlightCommands.empty())
         {
             return angle::Result::Continue;
@@ -793,6 +1209,11 @@ angle::Result CommandQueue::waitForResourceUseToFinishWithUserTimeout(ErrorConte
         return angle::Result::Continue;
     }
 
+    if (!(use <= mLastSubmittedSerials))
+    {
+        ANGLE_TRY(submitPendingBatches(context));
+    }
+
     VkDevice device      = context->getDevice();
     size_t finishedCount = 0;
     {
@@ -804,7 +1225,7 @@ angle::Result CommandQueue::waitForResourceUseToFinishWithUserTimeout(ErrorConte
             ANGLE_TRY(checkOneCommandBatchLocked(context, &finished));
             if (!finished)
             {
-                *result = mInFlightCommands.front().waitFenceUnlocked(device, timeout, &lock);
+                *result = waitForResourceUseUnlocked(device, use, timeout, &lock);
                 // Don't trigger an error on timeout.
                 if (*result == VK_TIMEOUT)
                 {
@@ -839,7 +1260,7 @@ bool CommandQueue::isBusy(Renderer *renderer) const
     size_t maxIndex = renderer->getLargestQueueSerialIndexEverAllocated();
     for (SerialIndex i = 0; i <= maxIndex; ++i)
     {
-        if (mLastSubmittedSerials[i] > mLastCompletedSerials[i])
+        if (mLastFlushedSerials[i] > mLastCompletedSerials[i])
         {
             return true;
         }
@@ -861,6 +1282,13 @@ angle::Result CommandQueue::submitCommands(
     Renderer *renderer = context->getRenderer();
     VkDevice device    = renderer->getDevice();
 
+    // Submissions that signal something visible outside ANGLE (the present semaphore, an exported
+    // fence, foreign queue ownership transfers) are made right away.  Everything else may be left
+    // to the QueueSubmitThread.
+    const bool deferSubmit = renderer->getFeatures().asyncQueueSubmit.enabled &&
+                             signalSemaphore == VK_NULL_HANDLE && !externalFence &&
+                             imagesToTransitionToForeign.empty();
+
     ++mPerfCounters.commandQueueSubmitCallsTotal;
     ++mPerfCounters.commandQueueSubmitCallsPerFrame;
 
@@ -901,9 +1329,11 @@ angle::Result CommandQueue::submitCommands(
         }
 
         // Initializing a fence is not required if the batch already has an external fence and does
-        // not need an extra fence after its submission.
+        // not need an extra fence after its submission, or if the batch signals the queue's
+        // timeline instead.
         const bool needsOwnedFence =
-            renderer->getFeatures().enableExtraSubmitFence.enabled || !externalFence;
+            externalFence ? renderer->getFeatures().enableExtraSubmitFence.enabled
+                          : !mUseTimelineSemaphores;
         if (needsOwnedFence)
         {
             ANGLE_VK_TRY(context, batch.initFence(device, &mFenceRecycler));
@@ -917,7 +1347,39 @@ angle::Result CommandQueue::submitCommands(
         ++mPerfCounters.vkQueueSubmitCallsPerFrame;
     }
 
-    return queueSubmitLocked(context, priority, submitInfo, scopedBatch, submitQueueSerial);
+    if (deferSubmit)
+    {
+        if (mPendingSubmissions.full())
+        {
+            std::lock_guard<angle::SimpleMutex> queueLock(mQueueMutex);
+            ANGLE_TRY(submitPendingBatchesLocked(context));
+        }
+
+        PendingSubmission submission;
+        submission.priority                = priority;
+        submission.needsQueueSubmit        = needsQueueSubmit;
+        submission.protectedSubmit         = protectedSubmitInfo.protectedSubmit == VK_TRUE;
+        submission.waitSemaphores          = std::move(waitSemaphores);
+        submission.waitSemaphoreStageMasks = std::move(waitSemaphoreStageMasks);
+        submission.batch                   = scopedBatch.release();
+        mPendingSubmissions.push(std::move(submission));
+
+        // mLastSubmittedSerials is only updated once the batch is in mInFlightCommands.  Anything
+        // that needs it there submits the pending batches first.
+        mLastFlushedSerials.setQueueSerial(submitQueueSerial);
+        return angle::Result::Continue;
+    }
+
+    // Keep submission order with batches deferred earlier.
+    std::lock_guard<angle::SimpleMutex> queueLock(mQueueMutex);
+    ANGLE_TRY(submitPendingBatchesLocked(context));
+    ANGLE_TRY(queueSubmitLocked(context, priority, submitInfo, scopedBatch));
+
+    // This must set last so that when this submission appears submitted, it actually already
+    // submitted and enqueued to mInFlightCommands.
+    mLastSubmittedSerials.setQueueSerial(submitQueueSerial);
+    mLastFlushedSerials.setQueueSerial(submitQueueSerial);
+    return angle::Result::Continue;
 }
 
 angle::Result CommandQueue::queueSubmitOneOff(ErrorContext *context,
@@ -928,13 +1390,19 @@ angle::Result CommandQueue::queueSubmitOneOff(ErrorContext *context,
                                               VkPipelineStageFlags waitSemaphoreStageMask,
                                               const QueueSerial &submitQueueSerial)
 {
-    std::unique_lock<angle::SimpleMutex> lock(mQueueSubmitMutex);
+    std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
+    std::lock_guard<angle::SimpleMutex> queueLock(mQueueMutex);
+    ANGLE_TRY(submitPendingBatchesLocked(context));
+
     DeviceScoped<CommandBatch> scopedBatch(context->getDevice());
     CommandBatch &batch = scopedBatch.get();
     batch.setQueueSerial(submitQueueSerial);
     batch.setProtectionType(protectionType);
 
-    ANGLE_VK_TRY(context, batch.initFence(context->getDevice(), &mFenceRecycler));
+    if (!mUseTimelineSemaphores)
+    {
+        ANGLE_VK_TRY(context, batch.initFence(context->getDevice(), &mFenceRecycler));
+    }
 
     VkSubmitInfo submitInfo = {};
     submitInfo.sType        = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -966,14 +1434,68 @@ angle::Result CommandQueue::queueSubmitOneOff(ErrorContext *context,
     ++mPerfCounters.vkQueueSubmitCallsTotal;
     ++mPerfCounters.vkQueueSubmitCallsPerFrame;
 
-    return queueSubmitLocked(context, contextPriority, submitInfo, scopedBatch, submitQueueSerial);
+    ANGLE_TRY(queueSubmitLocked(context, contextPriority, submitInfo, scopedBatch));
+
+    // This must set last so that when this submission appears submitted, it actually already
+    // submitted and enqueued to mInFlightCommands.
+    mLastSubmittedSerials.setQueueSerial(submitQueueSerial);
+    mLastFlushedSerials.setQueueSerial(submitQueueSerial);
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::submitPendingBatches(ErrorContext *context)
+{
+    // mQueueSubmitMutex is not needed: batches are only pushed with it held, and the ones pushed
+    // meanwhile are left to the next call.
+    std::lock_guard<angle::SimpleMutex> lock(mQueueMutex);
+    return submitPendingBatchesLocked(context);
+}
+
+angle::Result CommandQueue::submitPendingBatchesLocked(ErrorContext *context)
+{
+    VkDevice device = context->getDevice();
+    while (!mPendingSubmissions.empty())
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::submitPendingBatchesLocked");
+        PendingSubmission &submission = mPendingSubmissions.front();
+        const QueueSerial queueSerial = submission.batch.getQueueSerial();
+
+        DeviceScoped<CommandBatch> scopedBatch(device);
+        scopedBatch.get() = std::move(submission.batch);
+
+        VkSubmitInfo submitInfo                   = {};
+        VkProtectedSubmitInfo protectedSubmitInfo = {};
+        if (submission.needsQueueSubmit)
+        {
+            InitializeSubmitInfo(&submitInfo, scopedBatch.get().getPrimaryCommands(),
+                                 submission.waitSemaphores, submission.waitSemaphoreStageMasks,
+                                 VK_NULL_HANDLE);
+
+            if (submission.protectedSubmit)
+            {
+                protectedSubmitInfo.sType           = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
+                protectedSubmitInfo.pNext           = nullptr;
+                protectedSubmitInfo.protectedSubmit = true;
+                submitInfo.pNext                    = &protectedSubmitInfo;
+            }
+        }
+
+        const angle::Result result =
+            queueSubmitLocked(context, submission.priority, submitInfo, scopedBatch);
+
+        // Pop only now that the batch is in mInFlightCommands (or dropped on error).
+        mPendingSubmissions.pop();
+        ANGLE_TRY(result);
+
+        mLastSubmittedSerials.setQueueSerial(queueSerial);
+    }
+    return angle::Result::Continue;
 }
 
 angle::Result CommandQueue::queueSubmitLocked(ErrorContext *context,
                                               egl::ContextPriority contextPriority,
                                               const VkSubmitInfo &submitInfo,
-                                              DeviceScoped<CommandBatch> &commandBatch,
-                                              const QueueSerial &submitQueueSerial)
+                                              DeviceScoped<CommandBatch> &commandBatch)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::queueSubmitLocked");
     Renderer *renderer = context->getRenderer();
@@ -1008,11 +1530,47 @@ angle::Result CommandQueue::queueSubmitLocked(ErrorContext *context,
         CommandBatch &batch = commandBatch.get();
 
         VkQueue queue = getQueue(contextPriority);
+
+        // With timeline semaphores, the submission additionally signals the next value of the
+        // queue's timeline, which is what the batch is tracked with from then on.
+        VkSubmitInfo timelineSubmitInfo                     = submitInfo;
+        VkTimelineSemaphoreSubmitInfoKHR timelineSignalInfo = {};
+        std::array<VkSemaphore, 2> signalSemaphores         = {};
+        std::array<uint64_t, 2> signalValues                = {};
+        if (mUseTimelineSemaphores)
+        {
+            QueueTimeline *timeline = mPriorityTimelines[contextPriority];
+            ASSERT(submitInfo.signalSemaphoreCount <= 1);
+
+            uint32_t signalCount = 0;
+            if (submitInfo.signalSemaphoreCount > 0)
+            {
+                signalSemaphores[signalCount++] = submitInfo.pSignalSemaphores[0];
+            }
+            signalValues[signalCount]       = timeline->allocateSignalValue();
+            signalSemaphores[signalCount++] = timeline->getHandle();
+
+            timelineSignalInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineSignalInfo.pNext = submitInfo.pNext;
+
+            timelineSignalInfo.signalSemaphoreValueCount = signalCount;
+            timelineSignalInfo.pSignalSemaphoreValues    = signalValues.data();
+
+            timelineSubmitInfo.pNext                = &timelineSignalInfo;
+            timelineSubmitInfo.signalSemaphoreCount = signalCount;
+            timelineSubmitInfo.pSignalSemaphores    = signalSemaphores.data();
+
+            batch.setTimelineSignal(timeline, signalValues[signalCount - 1]);
+        }
+        const VkSubmitInfo &queueSubmitInfo =
+            mUseTimelineSemaphores ? timelineSubmitInfo : submitInfo;
+
         if (batch.getExternalFence())
         {
             VkFence externalFenceHandle = batch.getExternalFence()->getHandle();
             ASSERT(externalFenceHandle != VK_NULL_HANDLE);
-            ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, externalFenceHandle));
+            ANGLE_VK_TRY(context,
+                         vkQueueSubmit(queue, 1, &queueSubmitInfo, externalFenceHandle));
 
             // If enabled, there will be an extra fence submitted after the primary commands.
             if (renderer->getFeatures().enableExtraSubmitFence.enabled)
@@ -1034,6 +1592,10 @@ angle::Result CommandQueue::queueSubmitLocked(ErrorContext *context,
             fenceGetFdInfo.handleType          = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT_KHR;
             externalFence.exportFd(renderer->getDevice(), fenceGetFdInfo);
         }
+        else if (mUseTimelineSemaphores)
+        {
+            ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &queueSubmitInfo, VK_NULL_HANDLE));
+        }
         else
         {
             VkFence fence = batch.getFenceHandle();
@@ -1043,17 +1605,13 @@ angle::Result CommandQueue::queueSubmitLocked(ErrorContext *context,
     }
 
     pushInFlightBatchLocked(commandBatch.release());
-
-    // This must set last so that when this submission appears submitted, it actually already
-    // submitted and enqueued to mInFlightCommands.
-    mLastSubmittedSerials.setQueueSerial(submitQueueSerial);
     return angle::Result::Continue;
 }
 
 VkResult CommandQueue::queuePresent(egl::ContextPriority contextPriority,
                                     const VkPresentInfoKHR &presentInfo)
 {
-    std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
+    std::lock_guard<angle::SimpleMutex> lock(mQueueMutex);
     VkQueue queue = getQueue(contextPriority);
     return vkQueuePresentKHR(queue, &presentInfo);
 }
@@ -1206,6 +1764,33 @@ angle::Result CommandQueue::checkCompletedCommandsLocked(ErrorContext *context)
     return angle::Result::Continue;
 }
 
+VkResult CommandQueue::waitForResourceUseUnlocked(VkDevice device,
+                                                  const ResourceUse &use,
+                                                  uint64_t timeout,
+                                                  std::unique_lock<angle::SimpleMutex> *lock)
+{
+    ASSERT(!mInFlightCommands.empty());
+
+    const CommandBatch *batchToWaitOn = &mInFlightCommands.front();
+    if (mUseTimelineSemaphores && batchToWaitOn->hasFence())
+    {
+        // Only batches pushed before this point are looked at; pushes may happen concurrently.
+        const size_t inFlightCount = mInFlightCommands.size();
+        for (size_t index = inFlightCount - 1; index > 0; --index)
+        {
+            const CommandBatch &batch = mInFlightCommands[index];
+            if (batch.hasFence() && batch.isOnSameTimeline(*batchToWaitOn) &&
+                use >= batch.getQueueSerial())
+            {
+                batchToWaitOn = &batch;
+                break;
+            }
+        }
+    }
+
+    return batchToWaitOn->waitFenceUnlocked(device, timeout, lock);
+}
+
 void CommandQueue::pushInFlightBatchLocked(CommandBatch &&batch)
 {
     // Need to increment before the push to prevent possible decrement from 0.
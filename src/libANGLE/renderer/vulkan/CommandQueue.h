@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_COMMAND_Queue_H_
 #define LIBANGLE_RENDERER_VULKAN_COMMAND_Queue_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -31,6 +32,7 @@ using SharedExternalFence = std::shared_ptr<ExternalFence>;
 
 constexpr size_t kInFlightCommandsLimit    = 50u;
 constexpr size_t kMaxFinishedCommandsLimit = 64u;
+constexpr size_t kPendingSubmissionsLimit  = 16u;
 static_assert(kInFlightCommandsLimit <= kMaxFinishedCommandsLimit);
 
 struct Error
@@ -78,6 +80,38 @@ class RecyclableFence final : angle::NonCopyable
 
 using SharedFence = AtomicSharedPtr<RecyclableFence>;
 
+// A timeline semaphore that every submission to one VkQueue signals, with values increasing in
+// submission order.  With the useTimelineSemaphoreForSubmissions feature, this replaces the fence
+// per submission: a batch is finished once the counter reaches its value, and waiting for it is a
+// single vkWaitSemaphores call that needs no per-batch object.
+class QueueTimeline final : angle::NonCopyable
+{
+  public:
+    QueueTimeline();
+    ~QueueTimeline();
+
+    VkResult init(VkDevice device);
+    void destroy(VkDevice device);
+
+    bool valid() const { return mSemaphore.valid(); }
+    VkSemaphore getHandle() const { return mSemaphore.getHandle(); }
+
+    // Called with the queue submit mutex held, for the submission that is about to be made.
+    uint64_t allocateSignalValue() { return ++mLastAllocatedValue; }
+
+    // Returns VK_SUCCESS if the counter has reached |value| and VK_NOT_READY otherwise.
+    VkResult getStatus(VkDevice device, uint64_t value) const;
+    VkResult wait(VkDevice device, uint64_t value, uint64_t timeout) const;
+
+  private:
+    void onValueCompleted(uint64_t value) const;
+
+    Semaphore mSemaphore;
+    uint64_t mLastAllocatedValue;
+    // The last counter value read back, so values known to be reached need no query.
+    mutable std::atomic<uint64_t> mLastCompletedValue;
+};
+
 class CommandPoolAccess;
 class CommandBatch final : angle::NonCopyable
 {
@@ -97,6 +131,7 @@ class CommandBatch final : angle::NonCopyable
     void setSecondaryCommands(SecondaryCommandBufferCollector &&secondaryCommands);
     VkResult initFence(VkDevice device, FenceRecycler *recycler);
     void setExternalFence(SharedExternalFence &&externalFence);
+    void setTimelineSignal(const QueueTimeline *timeline, uint64_t value);
 
     const QueueSerial &getQueueSerial() const;
     const PrimaryCommandBuffer &getPrimaryCommands() const;
@@ -104,6 +139,7 @@ class CommandBatch final : angle::NonCopyable
 
     // Accessing the shared fence is prioritized before the shared external fence, since the shared
     // fence may be used in an extra empty submission after the external fence (via a feature flag).
+    // A timeline signal, if any, is prioritized before both.
     bool hasFence() const;
     VkFence getFenceHandle() const;
     VkResult getFenceStatus(VkDevice device) const;
@@ -112,6 +148,13 @@ class CommandBatch final : angle::NonCopyable
                                uint64_t timeout,
                                std::unique_lock<angle::SimpleMutex> *lock) const;
 
+    // Whether both batches signal the same queue timeline, in which case the one submitted later
+    // finishing implies the other finished too.
+    bool isOnSameTimeline(const CommandBatch &other) const
+    {
+        return mTimeline != nullptr && mTimeline == other.mTimeline;
+    }
+
   private:
     QueueSerial mQueueSerial;
     ProtectionType mProtectionType;
@@ -121,9 +164,25 @@ class CommandBatch final : angle::NonCopyable
     SecondaryCommandBufferCollector mSecondaryCommands;
     SharedFence mFence;
     SharedExternalFence mExternalFence;
+    // Owned by the CommandQueue, which outlives the batch.
+    const QueueTimeline *mTimeline;
+    uint64_t mTimelineValue;
 };
 using CommandBatchQueue = angle::FixedQueue<CommandBatch>;
 
+// A command batch that is ready to be submitted, but whose vkQueueSubmit is left to the
+// QueueSubmitThread.  Holds the data the VkSubmitInfo is built from.
+struct PendingSubmission
+{
+    CommandBatch batch;
+    egl::ContextPriority priority = egl::ContextPriority::InvalidEnum;
+    std::vector<VkSemaphore> waitSemaphores;
+    std::vector<VkPipelineStageFlags> waitSemaphoreStageMasks;
+    bool needsQueueSubmit = false;
+    bool protectedSubmit  = false;
+};
+using PendingSubmissionQueue = angle::FixedQueue<PendingSubmission>;
+
 class DeviceQueueMap;
 
 class QueueFamily final : angle::NonCopyable
@@ -206,6 +265,17 @@ class DeviceQueueMap final
     angle::PackedEnumMap<egl::ContextPriority, QueueAndIndex> mQueueAndIndices;
 };
 
+// A render pass that has been closed, but whose commands are yet to be recorded in the primary
+// command buffer.  Used when the render pass is replayed by RenderPassReplayThread.
+struct RenderPassReplayTask
+{
+    ProtectionType protectionType;
+    egl::ContextPriority priority;
+    VkRenderPass renderPass;
+    VkFramebuffer framebufferOverride;
+    RenderPassCommandBufferHelper *renderPassCommands;
+};
+
 class CommandPoolAccess : angle::NonCopyable
 {
   public:
@@ -230,6 +300,7 @@ class CommandPoolAccess : angle::NonCopyable
                                           const RenderPass &renderPass,
                                           VkFramebuffer framebufferOverride,
                                           RenderPassCommandBufferHelper **renderPassCommands);
+    angle::Result replayRenderPassCommands(ErrorContext *context, const RenderPassReplayTask &task);
 
     void flushWaitSemaphores(ProtectionType protectionType,
                              egl::ContextPriority priority,
@@ -315,10 +386,20 @@ class CommandQueue : angle::NonCopyable
     // The following are used to implement EGL_ANGLE_device_vulkan, and are called by the
     // application when it wants to access the VkQueue previously retrieved from ANGLE.  Do not call
     // these for synchronization within ANGLE.
-    void lockVulkanQueueForExternalAccess() { mQueueSubmitMutex.lock(); }
-    void unlockVulkanQueueForExternalAccess() { mQueueSubmitMutex.unlock(); }
+    void lockVulkanQueueForExternalAccess()
+    {
+        mQueueSubmitMutex.lock();
+        mQueueMutex.lock();
+    }
+    void unlockVulkanQueueForExternalAccess()
+    {
+        mQueueMutex.unlock();
+        mQueueSubmitMutex.unlock();
+    }
 
-    Serial getLastSubmittedSerial(SerialIndex index) const { return mLastSubmittedSerials[index]; }
+    // A batch left to the QueueSubmitThread counts as submitted for the following: it never needs
+    // to be flushed again, and waiting on it submits it first.
+    Serial getLastSubmittedSerial(SerialIndex index) const { return mLastFlushedSerials[index]; }
 
     // The ResourceUse still have unfinished queue serial by ANGLE or vulkan.
     bool hasResourceUseFinished(const ResourceUse &use) const
@@ -332,11 +413,11 @@ class CommandQueue : angle::NonCopyable
     // The ResourceUse still have queue serial not yet submitted to vulkan.
     bool hasResourceUseSubmitted(const ResourceUse &use) const
     {
-        return use <= mLastSubmittedSerials;
+        return use <= mLastFlushedSerials;
     }
     bool hasQueueSerialSubmitted(const QueueSerial &queueSerial) const
     {
-        return queueSerial <= mLastSubmittedSerials;
+        return queueSerial <= mLastFlushedSerials;
     }
 
     // Wait until the desired serial has been completed.
@@ -369,6 +450,11 @@ class CommandQueue : angle::NonCopyable
                                     VkPipelineStageFlags waitSemaphoreStageMask,
                                     const QueueSerial &submitQueueSerial);
 
+    // Submits the batches deferred by submitCommands.  Called by the QueueSubmitThread, and
+    // internally before waiting on the GPU or submitting anything that must keep queue order.
+    angle::Result submitPendingBatches(ErrorContext *context);
+    bool hasPendingSubmissions() const { return !mPendingSubmissions.empty(); }
+
     // Note: Some errors from present are not fatal.
     VkResult queuePresent(egl::ContextPriority contextPriority,
                           const VkPresentInfoKHR &presentInfo);
@@ -423,6 +509,11 @@ class CommandQueue : angle::NonCopyable
         return mCommandPoolAccess.flushRenderPassCommands(
             context, protectionType, priority, renderPass, framebufferOverride, renderPassCommands);
     }
+    ANGLE_INLINE angle::Result replayRenderPassCommands(ErrorContext *context,
+                                                        const RenderPassReplayTask &task)
+    {
+        return mCommandPoolAccess.replayRenderPassCommands(context, task);
+    }
 
     const angle::VulkanPerfCounters getPerfCounters() const;
     void resetPerFramePerfCounters();
@@ -462,12 +553,20 @@ class CommandQueue : angle::NonCopyable
     // Walk mInFlightCommands, check and update mLastCompletedSerials for all commands that are
     // finished
     angle::Result checkCompletedCommandsLocked(ErrorContext *context);
+    // Waits for the in-flight batches |use| needs, with |lock| released during the wait.  Usually
+    // this waits for the front batch; with timeline semaphores it waits for the last batch |use|
+    // needs on the front batch's queue instead, since that implies all the others on that queue.
+    VkResult waitForResourceUseUnlocked(VkDevice device,
+                                        const ResourceUse &use,
+                                        uint64_t timeout,
+                                        std::unique_lock<angle::SimpleMutex> *lock);
 
+    // These are called with mQueueMutex held.
     angle::Result queueSubmitLocked(ErrorContext *context,
                                     egl::ContextPriority contextPriority,
                                     const VkSubmitInfo &submitInfo,
-                                    DeviceScoped<CommandBatch> &commandBatch,
-                                    const QueueSerial &submitQueueSerial);
+                                    DeviceScoped<CommandBatch> &commandBatch);
+    angle::Result submitPendingBatchesLocked(ErrorContext *context);
 
     void pushInFlightBatchLocked(CommandBatch &&batch);
     void moveInFlightBatchToFinishedQueueLocked(CommandBatch &&batch);
@@ -477,9 +576,13 @@ class CommandQueue : angle::NonCopyable
     CommandPoolAccess mCommandPoolAccess;
 
     // Warning: Mutexes must be locked in the order as declared below.
-    // Protect multi-thread access to mInFlightCommands.push/back and ensure ordering of submission.
+    // Ensure ordering of submission and protect multi-thread access to mPendingSubmissions.push.
     // Also protects mPerfCounters.
     mutable angle::SimpleMutex mQueueSubmitMutex;
+    // Protect multi-thread access to the VkQueues, the queue timelines,
+    // mInFlightCommands.push/back and mPendingSubmissions.pop/front.  The QueueSubmitThread holds
+    // only this one across vkQueueSubmit, so that contexts can defer more batches meanwhile.
+    mutable angle::SimpleMutex mQueueMutex;
     // Protect multi-thread access to mInFlightCommands.pop/front and
     // mFinishedCommandBatches.push/back.
     angle::SimpleMutex mCmdCompleteMutex;
@@ -489,14 +592,20 @@ class CommandQueue : angle::NonCopyable
     CommandBatchQueue mInFlightCommands;
     // Temporary storage for finished command batches that should be reset.
     CommandBatchQueue mFinishedCommandBatches;
+    // Batches waiting for the QueueSubmitThread.  Pushed with mQueueSubmitMutex held and popped
+    // with mQueueMutex held.  The front batch is only popped once it is in mInFlightCommands, so
+    // checking empty() without a lock is enough to know whether anything is still to be submitted.
+    PendingSubmissionQueue mPendingSubmissions;
 
     // Combined number of batches in mInFlightCommands and mFinishedCommandBatches queues.
     // Used instead of calculating the sum because doing this is not thread safe and will require
     // the mCmdCompleteMutex lock.
     std::atomic_size_t mNumAllCommands;
 
-    // Queue serial management.
+    // Queue serial management.  mLastSubmittedSerials only covers batches in mInFlightCommands,
+    // while mLastFlushedSerials also covers those still in mPendingSubmissions.
     AtomicQueueSerialFixedArray mLastSubmittedSerials;
+    AtomicQueueSerialFixedArray mLastFlushedSerials;
     // This queue serial can be read/write from different threads, so we need to use atomic
     // operations to access the underlying value. Since we only do load/store on this value, it
     // should be just a normal uint64_t load/store on most platforms.
@@ -507,6 +616,12 @@ class CommandQueue : angle::NonCopyable
 
     FenceRecycler mFenceRecycler;
 
+    // Timelines for the useTimelineSemaphoreForSubmissions feature.  Priorities that map to the
+    // same VkQueue share the timeline of the first of them.
+    bool mUseTimelineSemaphores;
+    angle::PackedEnumMap<egl::ContextPriority, QueueTimeline> mQueueTimelines;
+    angle::PackedEnumMap<egl::ContextPriority, QueueTimeline *> mPriorityTimelines;
+
     angle::VulkanPerfCounters mPerfCounters;
 };
 
@@ -565,6 +680,90 @@ class CleanUpThread : public ErrorContext
     std::atomic<bool> mNeedCleanUp;
 };
 
+// A helper thread that calls vkQueueSubmit for the batches CommandQueue::submitCommands defers, so
+// that flushing does not block the context thread on the driver.
+class QueueSubmitThread : public ErrorContext
+{
+  public:
+    QueueSubmitThread(Renderer *renderer, CommandQueue *commandQueue);
+    ~QueueSubmitThread() override;
+
+    // Context
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override;
+
+    angle::Result init();
+
+    void destroy(ErrorContext *context);
+
+    void requestSubmit();
+
+    // Reports errors hit by earlier submissions to |errorHandlingContext|.
+    angle::Result checkAndPopPendingError(ErrorContext *errorHandlingContext);
+
+  private:
+    // Entry point for the submit thread.
+    void processTasks();
+
+    CommandQueue *const mCommandQueue;
+
+    mutable angle::SimpleMutex mErrorMutex;
+    std::queue<Error> mErrors;
+
+    std::thread mTaskThread;
+    bool mTaskThreadShouldExit;
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailableCondition;
+};
+
+// A helper thread that records closed render passes in the primary command buffer, so that the
+// context thread can go on recording the next render pass in the meantime.  Render passes are
+// replayed in the order they are enqueued.
+class RenderPassReplayThread : public ErrorContext
+{
+  public:
+    RenderPassReplayThread(Renderer *renderer, CommandQueue *commandQueue);
+    ~RenderPassReplayThread() override;
+
+    // Context
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override;
+
+    angle::Result init();
+
+    void destroy(ErrorContext *context);
+
+    // Takes ownership of |task.renderPassCommands|, which is recycled once replayed.
+    void enqueue(const RenderPassReplayTask &task);
+
+    // Waits until all enqueued render passes are recorded in their primary command buffer.  Must
+    // be called before anything else is recorded in, or taken out of, the primary command buffers.
+    angle::Result waitIdle(ErrorContext *context);
+
+  private:
+    angle::Result checkAndPopPendingError(ErrorContext *errorHandlingContext);
+
+    // Entry point for the replay thread.
+    void processTasks();
+
+    CommandQueue *const mCommandQueue;
+
+    mutable angle::SimpleMutex mErrorMutex;
+    std::queue<Error> mErrors;
+
+    std::thread mTaskThread;
+    bool mTaskThreadShouldExit;
+    bool mIsReplaying;
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailableCondition;
+    std::condition_variable mWorkDoneCondition;
+    std::queue<RenderPassReplayTask> mTasks;
+};
+
 // Provides access to the PrimaryCommandBuffer while also locking the corresponding CommandPool
 class [[nodiscard]] ScopedPrimaryCommandBuffer final
 {
@@ -682,6 +682,8 @@ constexpr angle::PackedEnumMap<RenderPassClosureReason, const char *> kRenderPas
      "Render pass closed due to reformatting texture to a renderable fallback"},
     {RenderPassClosureReason::DeviceLocalBufferMap,
      "Render pass closed due to mapping device local buffer"},
+    {RenderPassClosureReason::ScissoredLoadOpClearThenRenderAreaGrowth,
+     "Render pass closed due to render area growth after a scissored clear with loadOp=Clear"},
     {RenderPassClosureReason::PrepareForBlit, "Render pass closed prior to draw-based blit"},
     {RenderPassClosureReason::PrepareForImageCopy,
      "Render pass closed prior to draw-based image copy"},
@@ -852,6 +854,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mGpuEventsEnabled(false),
       mPrimaryBufferEventCounter(0),
       mHasDeferredFlush(false),
+      mHasDeferredUnMakeCurrentSubmission(false),
+      mHasUnsubmittedCrossShareGroupWork(false),
       mHasAnyCommandsPendingSubmission(false),
       mIsInColorFramebufferFetchMode(false),
       mAllowRenderPassToReactivate(true),
@@ -1206,9 +1210,13 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
     mPerfMonitorCounters.push_back(vulkanGroup);
 
     mCurrentGarbage.reserve(32);
+    mRenderer->registerPerContextGarbageList(&mPerContextGarbage);
 }
 
-ContextVk::~ContextVk() {}
+ContextVk::~ContextVk()
+{
+    mRenderer->unregisterPerContextGarbageList(&mPerContextGarbage);
+}
 
 void ContextVk::onDestroy(const gl::Context *context)
 {
@@ -1248,7 +1256,7 @@ void ContextVk::onDestroy(const gl::Context *context)
 
     for (vk::DynamicQueryPool &queryPool : mQueryPools)
     {
-        queryPool.destroy(device);
+        queryPool.destroy(mRenderer);
     }
 
     // Recycle current command buffers.
@@ -1465,6 +1473,10 @@ bool ContextVk::hasSomethingToFlush() const
 
 angle::Result ContextVk::flushImpl(const gl::Context *context)
 {
+    // A flush ensures the deferred submissions of the share group are made, even if this context
+    // has nothing to flush itself.
+    ANGLE_TRY(mShareGroupVk->submitDeferredUnMakeCurrentCommands(this));
+
     // Skip if there's nothing to flush.
     if (!hasSomethingToFlush())
     {
@@ -2371,10 +2383,12 @@ angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirt
     gl::Rectangle renderArea = drawFramebufferVk->getRenderArea(this);
     // Check to see if we can reactivate the current renderPass, if all arguments that we use to
     // start the render pass is the same. We don't need to check clear values since mid render pass
-    // clear are handled differently.
+    // clear are handled differently.  The render pass may have been started by a different
+    // framebuffer with identical attachments.
     bool reactivateStartedRenderPass =
-        hasStartedRenderPassWithQueueSerial(drawFramebufferVk->getLastRenderPassQueueSerial()) &&
-        mAllowRenderPassToReactivate && renderArea == mRenderPassCommands->getRenderArea();
+        mAllowRenderPassToReactivate &&
+        continueStartedRenderPassWithFramebuffer(drawFramebufferVk) &&
+        renderArea == mRenderPassCommands->getRenderArea();
     if (reactivateStartedRenderPass)
     {
         INFO() << "Reactivate already started render pass on draw.";
@@ -3692,7 +3706,7 @@ angle::Result ContextVk::submitCommands(const vk::Semaphore *signalSemaphore,
         // Clean up garbage.
         vk::ResourceUse use(mLastFlushedQueueSerial);
         size_t capacity = mCurrentGarbage.capacity();
-        mRenderer->collectGarbage(use, std::move(mCurrentGarbage));
+        mRenderer->collectGarbage(use, std::move(mCurrentGarbage), &mPerContextGarbage);
         // Make sure we don't lose capacity after the move to avoid storage reallocation.
         mCurrentGarbage.reserve(capacity);
     }
@@ -3735,7 +3749,7 @@ angle::Result ContextVk::submitCommands(const vk::Semaphore *signalSemaphore,
     // draw the first frame.
     if (mRenderer->getSuballocationDestroyedSize() >= kMaxTotalEmptyBufferBytes)
     {
-        mShareGroupVk->pruneDefaultBufferPools();
+        mShareGroupVk->pruneDefaultBufferPools(false);
     }
 
     return angle::Result::Continue;
@@ -5155,6 +5169,13 @@ void ContextVk::updateScissor(const gl::State &glState)
         !mRenderPassCommands->getRenderArea().encloses(rotatedScissoredArea))
     {
         ASSERT(mRenderPassCommands->started());
+        if (!mRenderPassCommands->canGrowRenderArea(rotatedScissoredArea))
+        {
+            // The render pass was started by a scissored clear that used loadOp=Clear, and draws
+            // have been recorded since.  Let the next draw start a new render pass instead.
+            onRenderPassFinished(RenderPassClosureReason::ScissoredLoadOpClearThenRenderAreaGrowth);
+            return;
+        }
         mRenderPassCommands->growRenderArea(this, rotatedScissoredArea);
     }
 }
@@ -5800,6 +5821,12 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                     break;
                 }
 
+                // If the new framebuffer has the same attachments as the one that started the
+                // render pass, the render pass is reactivated on the next draw.  The state below
+                // still needs to be updated as draw buffers, viewport flip etc may differ.
+                const bool continuesRenderPass =
+                    continueStartedRenderPassWithFramebuffer(drawFramebufferVk);
+
                 onRenderPassFinished(RenderPassClosureReason::FramebufferBindingChange);
                 // If we are switching from user FBO to system frame buffer, we always submit work
                 // first so that these FBO rendering will not have to wait for ANI semaphore (which
@@ -5822,7 +5849,7 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                      allowExceptionForSubmitAtBoundary);
 
                 if ((shouldSubmitAtFBOBoundary || mState.getDrawFramebuffer()->isDefault()) &&
-                    mRenderPassCommands->started())
+                    mRenderPassCommands->started() && !continuesRenderPass)
                 {
                     // This will behave as if user called glFlush, but the actual flush will be
                     // triggered at endRenderPass time.
@@ -6140,6 +6167,21 @@ angle::Result ContextVk::onMakeCurrent(const gl::Context *context)
 {
     mRenderer->reloadVolkIfNeeded();
 
+    // If the submission of this context's commands was deferred when it was last made uncurrent,
+    // they are submitted along with the commands recorded from now on.  If other contexts were
+    // made uncurrent since, their commands may depend on this context's, so submit in order now.
+    if (mHasDeferredUnMakeCurrentSubmission)
+    {
+        ASSERT(mCurrentQueueSerialIndex != kInvalidQueueSerialIndex);
+        if (!mShareGroupVk->isLastDeferredUnMakeCurrentSubmission(this))
+        {
+            ANGLE_TRY(
+                flushAndSubmitCommands(nullptr, nullptr, RenderPassClosureReason::ContextChange));
+        }
+        mShareGroupVk->onDeferredUnMakeCurrentSubmissionDone(this);
+        mHasDeferredUnMakeCurrentSubmission = false;
+    }
+
     if (mCurrentQueueSerialIndex == kInvalidQueueSerialIndex)
     {
         ANGLE_TRY(allocateQueueSerialIndex());
@@ -6188,6 +6230,13 @@ angle::Result ContextVk::onUnMakeCurrent(const gl::Context *context)
     ANGLE_TRY(flushAndSubmitCommands(nullptr, nullptr, RenderPassClosureReason::ContextChange));
     mCurrentWindowSurface = nullptr;
 
+    // The context is being destroyed while its submission is deferred.
+    if (mHasDeferredUnMakeCurrentSubmission)
+    {
+        mShareGroupVk->onDeferredUnMakeCurrentSubmissionDone(this);
+        mHasDeferredUnMakeCurrentSubmission = false;
+    }
+
     if (mCurrentQueueSerialIndex != kInvalidQueueSerialIndex)
     {
         releaseQueueSerialIndex();
@@ -6195,6 +6244,61 @@ angle::Result ContextVk::onUnMakeCurrent(const gl::Context *context)
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::onUnMakeCurrentForShareGroupSwitch(const gl::Context *context)
+{
+    // Another context of the share group is about to be made current on this thread.  Instead of
+    // submitting right away, the submission is deferred until a context of the share group submits
+    // (which submits this context's commands first, so they execute in order) or this context is
+    // made current again.  The render pass is closed regardless: the next context tracks the state
+    // of shared images as if the render pass had ended.
+    //
+    // Work that others may wait on or that involves the window surface is submitted as usual.  So
+    // is work that creates sync objects or uses EGLImage, foreign or external memory images: other
+    // share groups (and threads) may wait on the syncs, or record commands against the image
+    // layouts left behind by this context's commands, and only eglMakeCurrent's implicit flush
+    // orders them.
+    const bool canDeferSubmission =
+        getFeatures().deferSubmissionOnShareGroupContextSwitch.enabled &&
+        mCurrentQueueSerialIndex != kInvalidQueueSerialIndex && mCurrentWindowSurface == nullptr &&
+        !mHasDeferredFlush && !mHasUnsubmittedCrossShareGroupWork && mWaitSemaphores.empty() &&
+        !mHasWaitSemaphoresPendingSubmission && !hasForeignImagesToTransition();
+    if (!canDeferSubmission)
+    {
+        return onUnMakeCurrent(context);
+    }
+
+    ANGLE_TRY(flushCommandsAndEndRenderPassWithoutSubmit(RenderPassClosureReason::ContextChange));
+
+    // The use of shared images by the render pass is only known once it's flushed.
+    if (mHasUnsubmittedCrossShareGroupWork)
+    {
+        return onUnMakeCurrent(context);
+    }
+
+    if (mLastFlushedQueueSerial == mLastSubmittedQueueSerial)
+    {
+        // Nothing to submit.
+        releaseQueueSerialIndex();
+        return angle::Result::Continue;
+    }
+
+    mShareGroupVk->onDeferredUnMakeCurrentSubmission(this);
+    mHasDeferredUnMakeCurrentSubmission = true;
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::submitDeferredUnMakeCurrentCommands()
+{
+    ASSERT(mHasDeferredUnMakeCurrentSubmission);
+    mHasDeferredUnMakeCurrentSubmission = false;
+
+    ANGLE_TRY(flushAndSubmitCommands(nullptr, nullptr, RenderPassClosureReason::ContextChange));
+    releaseQueueSerialIndex();
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::onSurfaceUnMakeCurrent(WindowSurfaceVk *surface)
 {
     // It is possible to destroy "WindowSurfaceVk" while not all rendering commands are submitted:
@@ -6615,6 +6719,60 @@ angle::Result ContextVk::onFramebufferChange(FramebufferVk *framebufferVk, gl::C
     return angle::Result::Continue;
 }
 
+void ContextVk::onFramebufferRenderPassStarted(const vk::FramebufferDesc &framebufferDesc)
+{
+    if (!getFeatures().mergeRenderPassesAcrossFramebuffers.enabled)
+    {
+        return;
+    }
+
+    mStartedRenderPassFramebufferDesc        = framebufferDesc;
+    mStartedRenderPassFramebufferQueueSerial = mRenderPassCommands->getQueueSerial();
+}
+
+bool ContextVk::continueStartedRenderPassWithFramebuffer(FramebufferVk *framebufferVk)
+{
+    if (hasStartedRenderPassWithQueueSerial(framebufferVk->getLastRenderPassQueueSerial()))
+    {
+        return true;
+    }
+
+    // Engines often create one framebuffer object per pass, even when consecutive passes render
+    // to the same images.  If the attachments (image views, layers, unresolve and fetch modes,
+    // etc) match those of the framebuffer that started the render pass, switching to it does not
+    // need to break the render pass.
+    if (!getFeatures().mergeRenderPassesAcrossFramebuffers.enabled ||
+        !mAllowRenderPassToReactivate ||
+        !hasStartedRenderPassWithQueueSerial(mStartedRenderPassFramebufferQueueSerial))
+    {
+        return false;
+    }
+
+    // Deferred clears would need to modify the render pass loadOps.
+    if (framebufferVk->hasDeferredClears() ||
+        framebufferVk->getRenderArea(this) != mRenderPassCommands->getRenderArea() ||
+        !(framebufferVk->getCurrentFramebufferDesc() == mStartedRenderPassFramebufferDesc))
+    {
+        return false;
+    }
+
+    vk::RenderPassDesc framebufferRenderPassDesc = framebufferVk->getRenderPassDesc();
+    if (getFeatures().preferDynamicRendering.enabled)
+    {
+        // See handleDirtyGraphicsRenderPass.
+        framebufferRenderPassDesc.setFramebufferFetchMode(
+            mRenderPassCommands->getRenderPassDesc().framebufferFetchMode());
+    }
+    if (!(framebufferRenderPassDesc == mRenderPassCommands->getRenderPassDesc()))
+    {
+        return false;
+    }
+
+    framebufferVk->onRenderPassContinued(mRenderPassCommands->getQueueSerial());
+    mPerfCounters.renderPassesMergedAcrossFramebuffers++;
+    return true;
+}
+
 void ContextVk::onDrawFramebufferRenderPassDescChange(FramebufferVk *framebufferVk,
                                                       bool *renderPassDescChangedOut)
 {
@@ -6774,7 +6932,9 @@ void ContextVk::invalidateGraphicsDescriptorSet(DescriptorSetIndex usedDescripto
     ASSERT(usedDescriptorSet == DescriptorSetIndex::Internal);
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
 
-    if (executable && executable->hasUniformBuffers())
+    // Pushed descriptors don't survive UtilsVk binding its own pipeline layout, so push them again.
+    if (executable && (executable->hasUniformBuffers() ||
+                       vk::GetImpl(executable)->texturesUsePushDescriptor()))
     {
         mGraphicsDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
         return;
@@ -6787,7 +6947,9 @@ void ContextVk::invalidateComputeDescriptorSet(DescriptorSetIndex usedDescriptor
     ASSERT(usedDescriptorSet == DescriptorSetIndex::Internal);
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
 
-    if (executable && executable->hasUniformBuffers())
+    // Pushed descriptors don't survive UtilsVk binding its own pipeline layout, so push them again.
+    if (executable && (executable->hasUniformBuffers() ||
+                       vk::GetImpl(executable)->texturesUsePushDescriptor()))
     {
         mComputeDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
         return;
@@ -7291,6 +7453,13 @@ angle::Result ContextVk::initBufferAllocation(vk::BufferHelper *bufferHelper,
                                               size_t alignment,
                                               BufferUsageType bufferUsageType)
 {
+    // If the heap is close to its budget, free the memory that the GPU is already done with before
+    // adding to it.
+    if (mRenderer->isMemoryTypeNearBudget(memoryTypeIndex, allocationSize))
+    {
+        mRenderer->cleanupGarbage(nullptr);
+    }
+
     vk::BufferPool *pool = getDefaultBufferPool(allocationSize, memoryTypeIndex, bufferUsageType);
     VkResult result      = bufferHelper->initSuballocation(this, memoryTypeIndex, allocationSize,
                                                            alignment, bufferUsageType, pool);
@@ -7376,6 +7545,12 @@ angle::Result ContextVk::initImageAllocation(vk::ImageHelper *imageHelper,
     bool allocateDedicatedMemory =
         mRenderer->getImageMemorySuballocator().needsDedicatedMemory(memoryRequirements.size);
 
+    // The memory type is only known once allocated, so check every heap against its budget.
+    if (mRenderer->isAnyHeapNearBudget())
+    {
+        mRenderer->cleanupGarbage(nullptr);
+    }
+
     VkResult result = imageHelper->initMemory(this, memoryProperties, flags, oomExcludedFlags,
                                               &memoryRequirements, allocateDedicatedMemory,
                                               allocationType, &outputFlags, &outputSize);
@@ -7786,6 +7961,14 @@ angle::Result ContextVk::flushAndSubmitCommands(const vk::Semaphore *signalSemap
                                                 const vk::SharedExternalFence *externalFence,
                                                 RenderPassClosureReason renderPassClosureReason)
 {
+    // Commands of other contexts of the share group whose submission was deferred on a context
+    // switch may have been recorded before this context's, so submit them first.
+    ANGLE_TRY(mShareGroupVk->submitDeferredUnMakeCurrentCommands(this));
+
+    // Copy the buffers that are expected to be mapped for reading, if these commands write to them.
+    // Done first so the copies are included in the submission below.
+    ANGLE_TRY(mShareGroupVk->recordSpeculativeBufferReadbacks(this));
+
     // Even if render pass does not have any command, we may still need to submit it in case it has
     // CLEAR loadOp.
     bool someCommandsNeedFlush =
@@ -7896,7 +8079,8 @@ angle::Result ContextVk::flushAndSubmitCommands(const vk::Semaphore *signalSemap
     }
 
     // Since we just flushed, deferred flush is no longer deferred.
-    mHasDeferredFlush = false;
+    mHasDeferredFlush                  = false;
+    mHasUnsubmittedCrossShareGroupWork = false;
     return angle::Result::Continue;
 }
 
@@ -8269,11 +8453,16 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     {
         mIsAnyHostVisibleBufferWritten = true;
     }
+    if (mRenderPassCommands->getAndResetUsesImageSharedAcrossShareGroups())
+    {
+        mHasUnsubmittedCrossShareGroupWork = true;
+    }
 
     // The counter for pending submission count is used for possible submission at FBO boundary and
     // flush.
     mCommandsPendingSubmissionCount +=
         mRenderPassCommands->getCommandBuffer().getRenderPassWriteCommandCount();
+    mRenderPassCommands->addBarrierPerfCounters(mRenderer, &mPerfCounters);
 
     ANGLE_TRY(mRenderer->flushRenderPassCommands(this, getProtectionType(), mContextPriority,
                                                  *renderPass, framebufferOverride,
@@ -8287,6 +8476,9 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     // Generate a new serial for outside commands.
     generateOutsideRenderPassCommandsQueueSerial();
 
+    // Now that the render pass is flushed, copy the results of the queries that ended in it.
+    flushPendingQueryResultCopies();
+
     if (mGpuEventsEnabled)
     {
         EventName eventName = GetTraceEventName("RP", mPerfCounters.renderPasses);
@@ -8407,7 +8599,8 @@ angle::Result ContextVk::onSyncObjectInit(vk::SyncHelper *syncHelper, SyncFenceS
     // original context never issued a submission naturally.  Note that this also takes care of
     // contexts that think they issued a submission (through glFlush) but that the submission got
     // deferred.
-    mHasDeferredFlush = true;
+    mHasDeferredFlush                  = true;
+    mHasUnsubmittedCrossShareGroupWork = true;
 
     return angle::Result::Continue;
 }
@@ -8553,6 +8746,11 @@ angle::Result ContextVk::flushOutsideRenderPassCommands()
     {
         mIsAnyHostVisibleBufferWritten = true;
     }
+    if (mOutsideRenderPassCommands->getAndResetUsesImageSharedAcrossShareGroups())
+    {
+        mHasUnsubmittedCrossShareGroupWork = true;
+    }
+    mOutsideRenderPassCommands->addBarrierPerfCounters(mRenderer, &mPerfCounters);
     ANGLE_TRY(mRenderer->flushOutsideRPCommands(this, getProtectionType(), mContextPriority,
                                                 &mOutsideRenderPassCommands));
 
@@ -8654,6 +8852,20 @@ angle::Result ContextVk::endRenderPassQuery(QueryVk *queryVk)
     return angle::Result::Continue;
 }
 
+void ContextVk::flushPendingQueryResultCopies()
+{
+    for (vk::DynamicQueryPool &queryPool : mQueryPools)
+    {
+        if (queryPool.hasPendingResultCopies())
+        {
+            queryPool.flushPendingResultCopies(&mOutsideRenderPassCommands->getCommandBuffer(),
+                                               mOutsideRenderPassCommands->getQueueSerial());
+            // The results are read by the host, which needs a barrier at submission.
+            mIsAnyHostVisibleBufferWritten = true;
+        }
+    }
+}
+
 void ContextVk::pauseRenderPassQueriesIfActive()
 {
     for (QueryVk *activeQuery : mActiveRenderPassQueries)
@@ -9278,6 +9490,8 @@ void ContextVk::resetPerFramePerfCounters()
     mPerfCounters.renderPasses                           = 0;
     mPerfCounters.writeDescriptorSets                    = 0;
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
+    mPerfCounters.pipelineBarriersRequested              = 0;
+    mPerfCounters.pipelineBarriersIssued                 = 0;
     mPerfCounters.resolveImageCommands                   = 0;
     mPerfCounters.descriptorSetAllocations               = 0;
 
@@ -309,6 +309,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // Context switching
     angle::Result onMakeCurrent(const gl::Context *context) override;
     angle::Result onUnMakeCurrent(const gl::Context *context) override;
+    angle::Result onUnMakeCurrentForShareGroupSwitch(const gl::Context *context) override;
+    // Submits the commands whose submission was deferred by onUnMakeCurrentForShareGroupSwitch.
+    // Called by the share group on behalf of another context.
+    angle::Result submitDeferredUnMakeCurrentCommands();
     angle::Result onSurfaceUnMakeCurrent(WindowSurfaceVk *surface);
     angle::Result onSurfaceUnMakeCurrent(OffscreenSurfaceVk *surface);
 
@@ -641,6 +645,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void disableRenderPassReactivation() { mAllowRenderPassToReactivate = false; }
 
+    // Called by FramebufferVk when it starts a render pass.  Another framebuffer with identical
+    // attachments is then allowed to continue the render pass instead of starting a new one.
+    void onFramebufferRenderPassStarted(const vk::FramebufferDesc &framebufferDesc);
+
     // Only returns true if we have a started RP and we've run setupDraw.
     bool hasActiveRenderPass() const
     {
@@ -763,6 +771,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result handleGraphicsEventLog(GraphicsEventCmdBuf queryEventType);
 
     void flushDescriptorSetUpdates();
+    // Records the copies of query results to host-visible memory for the queries that ended in the
+    // render pass that was just flushed.
+    void flushPendingQueryResultCopies();
 
     vk::BufferPool *getDefaultBufferPool(VkDeviceSize size,
                                          uint32_t memoryTypeIndex,
@@ -826,6 +837,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     const angle::ImageLoadContext &getImageLoadContext() const { return mImageLoadContext; }
 
     bool hasUnsubmittedUse(const vk::ResourceUse &use) const;
+    // Like hasUnsubmittedUse, but ignores the deferred submissions of other contexts in the share
+    // group.
+    bool hasUnsubmittedUseInThisContext(const vk::ResourceUse &use) const;
     bool hasUnsubmittedUse(const vk::Resource &resource) const
     {
         return hasUnsubmittedUse(resource.getResourceUse());
@@ -1424,6 +1438,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void updateDither();
 
+    // Returns true if |framebufferVk| continues the started render pass, either because it started
+    // it or because its attachments are identical to the framebuffer that did.
+    bool continueStartedRenderPassWithFramebuffer(FramebufferVk *framebufferVk);
+
     // For dynamic rendering only, mark the current render pass as being in framebuffer fetch mode.
     // In this mode, the FramebufferVk object and its render pass description are unaffected by
     // framebuffer fetch use, and the context needs to just configure the command buffer for
@@ -1610,6 +1628,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // submission queueSerial. Note: Resource based shared object should always be added to
     // renderer's mSharedGarbageList.
     vk::GarbageObjects mCurrentGarbage;
+    // Garbage of submitted commands, retired without taking any locks.  The renderer merges this
+    // into its shared garbage list on clean up.
+    vk::PerContextGarbageList mPerContextGarbage;
 
     RenderPassCache mRenderPassCache;
     // Used with dynamic rendering as it doesn't use render passes.
@@ -1653,6 +1674,15 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // render pass.
     bool mHasDeferredFlush;
 
+    // Whether the context is no longer current, but the submission of its commands is deferred
+    // until another context of the share group submits or this context is made current again.
+    bool mHasDeferredUnMakeCurrentSubmission;
+    // Whether the commands recorded since the last submission create sync objects or use images
+    // that other share groups may also use.  Such commands are always submitted when the context
+    // is made uncurrent, as others may wait on them or depend on the image layouts they leave
+    // behind.
+    bool mHasUnsubmittedCrossShareGroupWork;
+
     // Whether this context has produced any commands so far.  While the renderer already skips
     // vkQueueSubmit when there is no command recorded, this variable allows glFlush itself to be
     // entirely skipped.  This is particularly needed for an optimization where the Surface is in
@@ -1677,6 +1707,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // True if current started render pass is allowed to reactivate.
     bool mAllowRenderPassToReactivate;
 
+    // The attachments of the framebuffer that started the render pass with the given serial.  Used
+    // to continue the render pass when switching to a framebuffer with identical attachments.
+    vk::FramebufferDesc mStartedRenderPassFramebufferDesc;
+    QueueSerial mStartedRenderPassFramebufferQueueSerial;
+
     // The size of copy commands issued between buffers and images. Used to submit the command
     // buffer for the outside render pass.
     VkDeviceSize mTotalBufferToImageCopySize;
@@ -1783,13 +1818,22 @@ ANGLE_INLINE angle::Result ContextVk::onVertexAttributeChange(size_t attribIndex
     return onVertexBufferChange(vertexBuffer);
 }
 
-ANGLE_INLINE bool ContextVk::hasUnsubmittedUse(const vk::ResourceUse &use) const
+ANGLE_INLINE bool ContextVk::hasUnsubmittedUseInThisContext(const vk::ResourceUse &use) const
 {
     return mCurrentQueueSerialIndex != kInvalidQueueSerialIndex &&
            use > QueueSerial(mCurrentQueueSerialIndex,
                              mRenderer->getLastSubmittedSerial(mCurrentQueueSerialIndex));
 }
 
+ANGLE_INLINE bool ContextVk::hasUnsubmittedUse(const vk::ResourceUse &use) const
+{
+    // The resource may also be used by commands of another context of the share group whose
+    // submission is deferred.  Callers respond by submitting, which submits those commands first.
+    return hasUnsubmittedUseInThisContext(use) ||
+           (mShareGroupVk->hasDeferredUnMakeCurrentSubmissions() &&
+            mShareGroupVk->hasDeferredUnMakeCurrentUse(use));
+}
+
 ANGLE_INLINE bool UseLineRaster(const ContextVk *contextVk, gl::PrimitiveMode mode)
 {
     return gl::IsLineMode(mode);
@@ -683,13 +683,45 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
                          : UpdateDepthFeedbackLoopReason::None));
     }
 
+    // If the render pass was started by a scissored clear that used loadOp=Clear, its render area
+    // cannot grow once other commands are recorded.  Close it if this clear is not contained in it.
+    if (contextVk->hasStartedRenderPassWithQueueSerial(mLastRenderPassQueueSerial) &&
+        !contextVk->getStartedRenderPassCommands().canGrowRenderArea(scissoredRenderArea))
+    {
+        ANGLE_TRY(contextVk->flushCommandsAndEndRenderPass(
+            RenderPassClosureReason::ScissoredLoadOpClearThenRenderAreaGrowth));
+    }
+
     const bool scissoredClear = scissoredRenderArea != getRotatedCompleteRenderArea(contextVk);
 
     // We use the draw path if scissored clear, or color or stencil are masked.  Note that depth
     // clearing is already disabled if there's a depth mask.
-    const bool maskedClearColor = clearColor && (mActiveColorComponentMasksForClear & colorMasks) !=
-                                                    mActiveColorComponentMasksForClear;
-    const bool maskedClearStencil = clearStencil && stencilMask != 0xFF;
+    bool maskedClearColor = clearColor && (mActiveColorComponentMasksForClear & colorMasks) !=
+                                              mActiveColorComponentMasksForClear;
+    bool maskedClearStencil = clearStencil && stencilMask != 0xFF;
+
+    // If the attachments that are masked-cleared already have a deferred clear, fold the new clear
+    // in the deferred one; the channels and bits that are not masked take the new value.  This
+    // avoids a draw call, and the clear can still be done with loadOp=Clear.
+    VkClearDepthStencilValue adjustedClearDepthStencilValue = clearDepthStencilValue;
+    if (!scissoredClear)
+    {
+        if (maskedClearColor && !anyAttachmentWithColorspaceOverride &&
+            (mDeferredClears.getColorMask() & clearColorBuffers) == clearColorBuffers &&
+            foldMaskedColorClearIntoDeferredClears(clearColorBuffers, colorMasks,
+                                                   &adjustedClearColorValues))
+        {
+            maskedClearColor = false;
+        }
+
+        if (maskedClearStencil && mDeferredClears.testStencil())
+        {
+            adjustedClearDepthStencilValue.stencil =
+                (clearDepthStencilValue.stencil & stencilMask) |
+                (mDeferredClears.getStencilValue() & ~static_cast<uint32_t>(stencilMask));
+            maskedClearStencil = false;
+        }
+    }
 
     bool clearColorWithDraw =
         clearColor && (maskedClearColor || scissoredClear || anyAttachmentWithColorspaceOverride);
@@ -745,7 +777,7 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
 
         mergeClearsWithDeferredClears(clearColorDrawBuffersMask, clearDepth && !clearDepthWithDraw,
                                       clearStencil && !clearStencilWithDraw,
-                                      adjustedClearColorValues, clearDepthStencilValue);
+                                      adjustedClearColorValues, adjustedClearDepthStencilValue);
     }
 
     // If any deferred clears, we can further defer them, clear them with vkCmdClearAttachments or
@@ -838,19 +870,27 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
     // shader/pipeline support would then be required (though this is pending removal of the
     // preferDrawOverClearAttachments workaround).
     //
-    // A potential optimization is to use loadOp=Clear for scissored clears, but care needs to be
-    // taken to either break the render pass on growRenderArea(), or to turn the op back to Load and
-    // revert to vkCmdClearAttachments.  This is not currently deemed necessary.
+    // If this clear starts the render pass, the render area is the scissor, and loadOp=Clear can be
+    // used instead.  If the render area later grows, the render pass helper either turns the op
+    // back to Load and reverts to vkCmdClearAttachments, or the render pass is broken.
     if (((clearColorBuffers.any() && !mEmulatedAlphaAttachmentMask.any() && !maskedClearColor) ||
          clearDepthWithDraw || (clearStencilWithDraw && !maskedClearStencil)) &&
         !preferDrawOverClearAttachments && !anyAttachmentWithColorspaceOverride)
     {
+        bool clearWithLoadOps = false;
         if (!contextVk->hasActiveRenderPass())
         {
             // Start a new render pass if necessary to record the commands.
             vk::RenderPassCommandBuffer *commandBuffer;
             gl::Rectangle renderArea = getRenderArea(contextVk);
             ANGLE_TRY(contextVk->startRenderPass(renderArea, &commandBuffer, nullptr));
+
+            // Multisampled-render-to-texture attachments are excluded, as they cannot fall back to
+            // loadOp=Load without an unresolve subpass.
+            clearWithLoadOps =
+                contextVk->getFeatures().clearScissoredAttachmentsWithLoadOp.enabled &&
+                renderArea == scissoredRenderArea &&
+                !contextVk->getStartedRenderPassCommands().getRenderPassDesc().isRenderToTexture();
         }
 
         // Build clear values
@@ -880,11 +920,21 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
         if (dsAspectFlags != 0)
         {
             VkClearValue dsClearValue = {};
-            dsClearValue.depthStencil = clearDepthStencilValue;
+            dsClearValue.depthStencil = adjustedClearDepthStencilValue;
             clears.store(vk::kUnpackedDepthIndex, dsAspectFlags, dsClearValue);
         }
 
-        clearWithCommand(contextVk, scissoredRenderArea, ClearWithCommand::Always, &clears);
+        if (clearWithLoadOps)
+        {
+            ASSERT(mDeferredClears.empty());
+            mDeferredClears = clears;
+            clearWithLoadOp(contextVk);
+            contextVk->getStartedRenderPassCommands().onScissoredLoadOpClear();
+        }
+        else
+        {
+            clearWithCommand(contextVk, scissoredRenderArea, ClearWithCommand::Always, &clears);
+        }
 
         if (!clearColorBuffers.any() && !clearStencilWithDraw)
         {
@@ -897,7 +947,7 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
     // bits. This can only be done with a draw call.
     return clearWithDraw(contextVk, scissoredRenderArea, clearColorBuffers, clearDepthWithDraw,
                          clearStencilWithDraw, colorMasks, stencilMask, adjustedClearColorValues,
-                         clearDepthStencilValue);
+                         adjustedClearDepthStencilValue);
 }
 
 angle::Result FramebufferVk::clearBufferfv(const gl::Context *context,
@@ -3196,6 +3246,46 @@ void FramebufferVk::mergeClearsWithDeferredClears(
     }
 }
 
+bool FramebufferVk::foldMaskedColorClearIntoDeferredClears(
+    gl::DrawBufferMask clearColorBuffers,
+    gl::BlendStateExt::ColorMaskStorage::Type colorMasks,
+    gl::DrawBuffersArray<VkClearColorValue> *clearColorValues) const
+{
+    const auto &colorRenderTargets = mRenderTargetCache.getColors();
+    for (size_t colorIndexGL : clearColorBuffers)
+    {
+        // The clear values of YUV attachments are swizzled, so they are not folded.
+        if (colorRenderTargets[colorIndexGL]->isYuvResolve())
+        {
+            return false;
+        }
+    }
+
+    for (size_t colorIndexGL : clearColorBuffers)
+    {
+        ASSERT(mDeferredClears.test(colorIndexGL));
+
+        std::array<bool, 4> channelMask;
+        gl::BlendStateExt::UnpackColorMask(
+            gl::BlendStateExt::ColorMaskStorage::GetValueIndexed(colorIndexGL, colorMasks),
+            &channelMask[0], &channelMask[1], &channelMask[2], &channelMask[3]);
+
+        // All color clear value types are 32 bits per channel, so the channels can be copied
+        // regardless of the format.
+        const VkClearColorValue &deferredClearColor = mDeferredClears[colorIndexGL].color;
+        VkClearColorValue &clearColor               = (*clearColorValues)[colorIndexGL];
+        for (size_t channel = 0; channel < channelMask.size(); ++channel)
+        {
+            if (!channelMask[channel])
+            {
+                clearColor.uint32[channel] = deferredClearColor.uint32[channel];
+            }
+        }
+    }
+
+    return true;
+}
+
 angle::Result FramebufferVk::clearWithDraw(
     ContextVk *contextVk,
     const gl::Rectangle &clearArea,
@@ -3777,6 +3867,7 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
         std::move(framebuffer), renderArea, mRenderPassDesc, renderPassAttachmentOps, colorIndexVk,
         depthStencilAttachmentIndex, packedClearValues, commandBufferOut));
     mLastRenderPassQueueSerial = contextVk->getStartedRenderPassCommands().getQueueSerial();
+    contextVk->onFramebufferRenderPassStarted(mCurrentFramebufferDesc);
 
     // Add the images to the renderpass tracking list (through onColorDraw).
     vk::PackedAttachmentIndex colorAttachmentIndex(0);
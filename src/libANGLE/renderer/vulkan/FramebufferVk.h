@@ -152,6 +152,13 @@ class FramebufferVk : public FramebufferImpl
     void releaseCurrentFramebuffer(ContextVk *contextVk);
 
     const QueueSerial &getLastRenderPassQueueSerial() const { return mLastRenderPassQueueSerial; }
+    // Called when this framebuffer continues a render pass started by another framebuffer with
+    // identical attachments.
+    void onRenderPassContinued(const QueueSerial &queueSerial)
+    {
+        mLastRenderPassQueueSerial = queueSerial;
+    }
+    const vk::FramebufferDesc &getCurrentFramebufferDesc() const { return mCurrentFramebufferDesc; }
 
     bool hasAnyExternalAttachments() const { return mIsExternalColorAttachments.any(); }
 
@@ -245,6 +252,10 @@ class FramebufferVk : public FramebufferImpl
         bool clearStencil,
         const gl::DrawBuffersArray<VkClearColorValue> &clearColorValues,
         const VkClearDepthStencilValue &clearDepthStencilValue);
+    bool foldMaskedColorClearIntoDeferredClears(
+        gl::DrawBufferMask clearColorBuffers,
+        gl::BlendStateExt::ColorMaskStorage::Type colorMasks,
+        gl::DrawBuffersArray<VkClearColorValue> *clearColorValues) const;
     angle::Result clearWithDraw(ContextVk *contextVk,
                                 const gl::Rectangle &clearArea,
                                 gl::DrawBufferMask clearColorBuffers,
@@ -110,6 +110,9 @@ egl::Error ImageVk::initialize(const egl::Display *display)
         mOwnsImage = false;
     }
 
+    // Contexts of other share groups may use the image through the EGLImage.
+    mImage->setIsEGLImageSibling();
+
     // mContext is no longer needed, make sure it's not used by accident.
     mContext = nullptr;
 
@@ -26,6 +26,10 @@ static_assert(kTrackMemoryAllocationSizes,
 // Only the allocation size counters are used (if enabled).
 constexpr bool kTrackMemoryAllocationDebug = false;
 #endif
+
+// A heap is considered near its budget once less than 1/kMemoryBudgetHeadroomDivisor of its budget
+// is left.
+constexpr VkDeviceSize kMemoryBudgetHeadroomDivisor = 8;
 }  // namespace
 
 namespace rx
@@ -212,6 +216,14 @@ void MemoryAllocationTracker::initMemoryTrackers()
         }
     }
 
+    for (size_t heapIndex = 0; heapIndex < mRenderer->getMemoryProperties().getMemoryHeapCount();
+         heapIndex++)
+    {
+        mHeapBudget[heapIndex]                    = 0;
+        mHeapUsageAtBudgetUpdate[heapIndex]       = 0;
+        mTrackedHeapSizeAtBudgetUpdate[heapIndex] = 0;
+    }
+
     resetPendingMemoryAlloc();
 }
 
@@ -503,6 +515,91 @@ void MemoryAllocationTracker::resetPendingMemoryAlloc()
     mPendingMemoryTypeIndex      = kInvalidMemoryTypeIndex;
 }
 
+void MemoryAllocationTracker::updateMemoryBudget()
+{
+    if (!kTrackMemoryAllocationSizes || !mRenderer->getFeatures().supportsMemoryBudget.enabled)
+    {
+        return;
+    }
+
+    VkPhysicalDeviceMemoryProperties2KHR memoryProperties;
+    memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
+    memoryProperties.pNext = nullptr;
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT memoryBudgetProperties;
+    memoryBudgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    memoryBudgetProperties.pNext = nullptr;
+    vk::AddToPNextChain(&memoryProperties, &memoryBudgetProperties);
+
+    vkGetPhysicalDeviceMemoryProperties2(mRenderer->getPhysicalDevice(), &memoryProperties);
+
+    for (uint32_t heapIndex = 0; heapIndex < memoryProperties.memoryProperties.memoryHeapCount;
+         heapIndex++)
+    {
+        mHeapBudget[heapIndex]              = memoryBudgetProperties.heapBudget[heapIndex];
+        mHeapUsageAtBudgetUpdate[heapIndex] = memoryBudgetProperties.heapUsage[heapIndex];
+        mTrackedHeapSizeAtBudgetUpdate[heapIndex] =
+            getActiveHeapMemoryAllocationsTotalSize(heapIndex);
+    }
+}
+
+bool MemoryAllocationTracker::isHeapNearMemoryBudget(uint32_t heapIndex,
+                                                     VkDeviceSize allocationSize) const
+{
+    if (!kTrackMemoryAllocationSizes)
+    {
+        return false;
+    }
+
+    ASSERT(heapIndex < mRenderer->getMemoryProperties().getMemoryHeapCount());
+    const VkDeviceSize budget = mHeapBudget[heapIndex];
+    if (budget == 0)
+    {
+        return false;
+    }
+
+    // Account for what has been allocated or freed through ANGLE since the budget was sampled.
+    // Allocations made by others in the meantime are only picked up at the next update.
+    const VkDeviceSize trackedSize         = getActiveHeapMemoryAllocationsTotalSize(heapIndex);
+    const VkDeviceSize trackedSizeAtUpdate = mTrackedHeapSizeAtBudgetUpdate[heapIndex];
+    VkDeviceSize estimatedUsage            = mHeapUsageAtBudgetUpdate[heapIndex];
+    if (trackedSize >= trackedSizeAtUpdate)
+    {
+        estimatedUsage += trackedSize - trackedSizeAtUpdate;
+    }
+    else
+    {
+        estimatedUsage -= std::min(estimatedUsage, trackedSizeAtUpdate - trackedSize);
+    }
+
+    return estimatedUsage + allocationSize > budget - budget / kMemoryBudgetHeadroomDivisor;
+}
+
+bool MemoryAllocationTracker::isAnyHeapNearMemoryBudget() const
+{
+    for (uint32_t heapIndex = 0; heapIndex < mRenderer->getMemoryProperties().getMemoryHeapCount();
+         heapIndex++)
+    {
+        if (isHeapNearMemoryBudget(heapIndex, 0))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+VkDeviceSize MemoryAllocationTracker::getActiveHeapMemoryAllocationsTotalSize(
+    uint32_t heapIndex) const
+{
+    VkDeviceSize totalSize = 0;
+    for (uint32_t allocTypeIndex = 0; allocTypeIndex < vk::kMemoryAllocationTypeCount;
+         allocTypeIndex++)
+    {
+        totalSize += mActivePerHeapMemoryAllocationsSize[allocTypeIndex][heapIndex];
+    }
+    return totalSize;
+}
+
 namespace vk
 {
 MemoryReport::MemoryReport()
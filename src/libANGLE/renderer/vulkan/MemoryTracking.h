@@ -188,7 +188,16 @@ class MemoryAllocationTracker : angle::NonCopyable
                                VkDeviceSize size,
                                uint32_t memoryTypeIndex);
 
+    // Memory budget tracking with VK_EXT_memory_budget. The budget and usage of each heap are
+    // sampled in updateMemoryBudget(). In between, the allocations tracked by this class are
+    // added to the sampled usage to estimate the current usage of the heap.
+    void updateMemoryBudget();
+    bool isHeapNearMemoryBudget(uint32_t heapIndex, VkDeviceSize allocationSize) const;
+    bool isAnyHeapNearMemoryBudget() const;
+
   private:
+    VkDeviceSize getActiveHeapMemoryAllocationsTotalSize(uint32_t heapIndex) const;
+
     // Pointer to parent renderer object.
     vk::Renderer *const mRenderer;
 
@@ -215,6 +224,13 @@ class MemoryAllocationTracker : angle::NonCopyable
     std::atomic<vk::MemoryAllocationType> mPendingMemoryAllocationType;
     std::atomic<uint32_t> mPendingMemoryTypeIndex;
 
+    // The budget and usage of each heap at the last updateMemoryBudget() call, as well as the
+    // total size of the allocations tracked in that heap at the time. A budget of zero means that
+    // the budget is unknown.
+    PerHeapMemoryAllocationSizeArray mHeapBudget;
+    PerHeapMemoryAllocationSizeArray mHeapUsageAtBudgetUpdate;
+    PerHeapMemoryAllocationSizeArray mTrackedHeapSizeAtBudgetUpdate;
+
     // Mutex is used to update the data when debug layers are enabled.
     angle::SimpleMutex mMemoryAllocationMutex;
 
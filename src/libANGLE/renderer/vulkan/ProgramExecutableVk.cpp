@@ -43,6 +43,8 @@ bool ValidateTransformedSpirV(vk::ErrorContext *context,
         options.isTransformFeedbackStage = options.isLastPreFragmentStage;
         options.useSpirvVaryingPrecisionFixer =
             context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
+        options.removeDeadCode =
+            shaderType != gl::ShaderType::Fragment && shaderType != gl::ShaderType::Compute;
 
         angle::spirv::Blob transformed;
         if (SpvTransformSpirvCode(options, variableInfoMap, spirvBlobs[shaderType], &transformed) !=
@@ -244,6 +246,31 @@ vk::GraphicsPipelineSubset GetWarmUpSubset(const angle::FeaturesVk &features)
                                                             : vk::GraphicsPipelineSubset::Complete;
 }
 
+bool CanPushTextureDescriptors(vk::ErrorContext *context,
+                               const vk::DescriptorSetLayoutDesc &textureSetDesc)
+{
+    vk::Renderer *renderer            = context->getRenderer();
+    const angle::FeaturesVk &features = context->getFeatures();
+    if (!features.supportsPushDescriptor.enabled || !features.pushTextureDescriptors.enabled ||
+        textureSetDesc.empty())
+    {
+        return false;
+    }
+
+    vk::DescriptorSetLayoutBindingVector bindings;
+    textureSetDesc.unpackBindings(&bindings);
+
+    uint32_t descriptorCount = 0;
+    for (const VkDescriptorSetLayoutBinding &binding : bindings)
+    {
+        descriptorCount += binding.descriptorCount;
+    }
+
+    return descriptorCount <= std::min(vk::kMaxPushDescriptorCount,
+                                       renderer->getPhysicalDevicePushDescriptorProperties()
+                                           .maxPushDescriptors);
+}
+
 angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
                                               const ShaderInterfaceVariableInfoMap &variableInfoMap,
                                               const vk::WriteDescriptorDescs &writeDescriptorDescs,
@@ -251,7 +278,8 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
                                               const gl::ProgramExecutable &executable,
                                               const gl::ActiveTextureArray<TextureVk *> &textures,
                                               const gl::SamplerBindingVector &samplers,
-                                              VkDescriptorSet descriptorSet)
+                                              VkDescriptorSet descriptorSet,
+                                              const VkWriteDescriptorSet **writeDescriptorSetsOut)
 {
     const std::vector<gl::SamplerBinding> &samplerBindings = executable.getSamplerBindings();
     const std::vector<GLuint> &samplerBoundTextureUnits = executable.getSamplerBoundTextureUnits();
@@ -281,6 +309,16 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
         // VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, this will not used.
         writeSet.pImageInfo = updateBuilder->allocDescriptorImageInfos(
             writeDescriptorDescs[writeIndex].descriptorCount);
+        if (writeSet.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER)
+        {
+            writeSet.pTexelBufferView =
+                updateBuilder->allocBufferViews(writeDescriptorDescs[writeIndex].descriptorCount);
+        }
+    }
+
+    if (writeDescriptorSetsOut != nullptr)
+    {
+        *writeDescriptorSetsOut = writeDescriptorSets;
     }
 
     for (uint32_t samplerIndex = 0; samplerIndex < samplerBindings.size(); ++samplerIndex)
@@ -314,9 +352,10 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
                 ANGLE_TRY(
                     textureVk->getBufferView(context, nullptr, &samplerBinding, false, &view));
 
-                VkBufferView &bufferView  = updateBuilder->allocBufferView();
-                bufferView                = view->getHandle();
-                writeSet.pTexelBufferView = &bufferView;
+                uint32_t viewIndex       = arrayElement + samplerUniform.getOuterArrayOffset();
+                VkBufferView *bufferView =
+                    const_cast<VkBufferView *>(&writeSet.pTexelBufferView[viewIndex]);
+                *bufferView = view->getHandle();
             }
             else
             {
@@ -616,6 +655,11 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
     options.useSpirvVaryingPrecisionFixer =
         context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
 
+    // Now that the interface between stages is known, remove the computation of outputs that the
+    // next stage does not consume.
+    options.removeDeadCode =
+        shaderType != gl::ShaderType::Fragment && shaderType != gl::ShaderType::Compute;
+
     ANGLE_TRY(
         SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
     ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType], transformedSpirvBlob.data(),
@@ -638,6 +682,8 @@ void ProgramInfo::release(ContextVk *contextVk)
 
 ProgramExecutableVk::ProgramExecutableVk(const gl::ProgramExecutable *executable)
     : ProgramExecutableImpl(executable),
+      mTexturesUsePushDescriptor(false),
+      mTexturePushDescriptors(nullptr),
       mImmutableSamplersMaxDescriptorCount(1),
       mUniformBufferDescriptorType(VK_DESCRIPTOR_TYPE_MAX_ENUM),
       mDynamicUniformDescriptorOffsets{},
@@ -683,6 +729,8 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
         descriptorSet.reset();
     }
     mValidDescriptorSetIndices.reset();
+    mTexturesUsePushDescriptor = false;
+    mTexturePushDescriptors    = nullptr;
 
     for (vk::DynamicDescriptorPoolPointer &pool : mDynamicDescriptorPools)
     {
@@ -1782,6 +1830,21 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     mTextureSetDesc = {};
     ANGLE_TRY(addTextureDescriptorSetDesc(context, activeTextures, &mTextureSetDesc));
 
+    // Push the texture descriptors if the device allows it.  Immutable samplers may need more than
+    // one descriptor per binding (see mImmutableSamplersMaxDescriptorCount), so they always go
+    // through a descriptor set.
+    mTexturesUsePushDescriptor =
+        mImmutableSamplerIndexMap.empty() && CanPushTextureDescriptors(context, mTextureSetDesc);
+    mTexturePushDescriptors = nullptr;
+    if (mTexturesUsePushDescriptor)
+    {
+        mTextureSetDesc.setPushDescriptor();
+        if (!mTexturePushDescriptorWrites)
+        {
+            mTexturePushDescriptorWrites = std::make_unique<UpdateDescriptorSetsBuilder>();
+        }
+    }
+
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mTextureSetDesc, &mDescriptorSetLayouts[DescriptorSetIndex::Texture]));
 
@@ -1821,9 +1884,12 @@ angle::Result ProgramExecutableVk::initializeDescriptorPools(
     ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::UniformsAndXfb].bindCachedDescriptorPool(
         context, mDefaultUniformAndXfbSetDesc, 1, descriptorSetLayoutCache,
         &mDynamicDescriptorPools[DescriptorSetIndex::UniformsAndXfb]));
-    ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::Texture].bindCachedDescriptorPool(
-        context, mTextureSetDesc, mImmutableSamplersMaxDescriptorCount, descriptorSetLayoutCache,
-        &mDynamicDescriptorPools[DescriptorSetIndex::Texture]));
+    if (!mTexturesUsePushDescriptor)
+    {
+        ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::Texture].bindCachedDescriptorPool(
+            context, mTextureSetDesc, mImmutableSamplersMaxDescriptorCount,
+            descriptorSetLayoutCache, &mDynamicDescriptorPools[DescriptorSetIndex::Texture]));
+    }
     return (*metaDescriptorPools)[DescriptorSetIndex::ShaderResource].bindCachedDescriptorPool(
         context, mShaderResourceSetDesc, 1, descriptorSetLayoutCache,
         &mDynamicDescriptorPools[DescriptorSetIndex::ShaderResource]);
@@ -2007,6 +2073,17 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
     PipelineType pipelineType,
     UpdateDescriptorSetsBuilder *updateBuilder)
 {
+    if (mTexturesUsePushDescriptor)
+    {
+        // There is no descriptor set to look up, allocate or update; the writes are recorded in
+        // the command buffer by bindDescriptorSets().
+        mTexturePushDescriptorWrites->discardDescriptorSetUpdates();
+        return UpdateFullTexturesDescriptorSet(
+            context, mVariableInfoMap, mTextureWriteDescriptorDescs,
+            mTexturePushDescriptorWrites.get(), *mExecutable, textures, samplers, VK_NULL_HANDLE,
+            &mTexturePushDescriptors);
+    }
+
     if (context->getFeatures().descriptorSetCache.enabled)
     {
         vk::SharedDescriptorSetCacheKey newSharedCacheKey;
@@ -2030,7 +2107,7 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
             ANGLE_TRY(UpdateFullTexturesDescriptorSet(
                 context, mVariableInfoMap, mTextureWriteDescriptorDescs, updateBuilder,
                 *mExecutable, textures, samplers,
-                mDescriptorSets[DescriptorSetIndex::Texture]->getDescriptorSet()));
+                mDescriptorSets[DescriptorSetIndex::Texture]->getDescriptorSet(), nullptr));
 
             const gl::ActiveTextureMask &activeTextureMask = mExecutable->getActiveSamplersMask();
             for (size_t textureUnit : activeTextureMask)
@@ -2049,7 +2126,8 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
 
         ANGLE_TRY(UpdateFullTexturesDescriptorSet(
             context, mVariableInfoMap, mTextureWriteDescriptorDescs, updateBuilder, *mExecutable,
-            textures, samplers, mDescriptorSets[DescriptorSetIndex::Texture]->getDescriptorSet()));
+            textures, samplers, mDescriptorSets[DescriptorSetIndex::Texture]->getDescriptorSet(),
+            nullptr));
     }
 
     mValidDescriptorSetIndices.set(DescriptorSetIndex::Texture);
@@ -2103,6 +2181,14 @@ angle::Result ProgramExecutableVk::bindDescriptorSets(
         mDescriptorSets[descriptorSetIndex]->updateLastUsedFrame(currentFrame);
     }
 
+    if (mTexturePushDescriptors != nullptr)
+    {
+        ASSERT(mTexturesUsePushDescriptor);
+        commandBuffer->pushDescriptorSet(
+            getPipelineLayout(), pipelineBindPoint, DescriptorSetIndex::Texture,
+            static_cast<uint32_t>(mTextureWriteDescriptorDescs.size()), mTexturePushDescriptors);
+    }
+
     return angle::Result::Continue;
 }
 
@@ -246,6 +246,8 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                      CommandBufferT *commandBuffer,
                                      PipelineType pipelineType);
 
+    bool texturesUsePushDescriptor() const { return mTexturesUsePushDescriptor; }
+
     bool usesDynamicUniformBufferDescriptors() const
     {
         return mUniformBufferDescriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
@@ -521,6 +523,13 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     vk::DescriptorSetArray<vk::DynamicDescriptorPoolPointer> mDynamicDescriptorPools;
     vk::BufferSerial mCurrentDefaultUniformBufferSerial;
 
+    // With VK_KHR_push_descriptor, the texture descriptors are pushed to the command buffer instead
+    // of being written to a descriptor set.  mTexturePushDescriptorWrites holds the writes made by
+    // the last updateTexturesDescriptorSet() call, and mTexturePushDescriptors points to them.
+    bool mTexturesUsePushDescriptor;
+    std::unique_ptr<UpdateDescriptorSetsBuilder> mTexturePushDescriptorWrites;
+    const VkWriteDescriptorSet *mTexturePushDescriptors;
+
     // We keep a reference to the pipeline and descriptor set layouts. This ensures they don't get
     // deleted while this program is in use.
     uint32_t mImmutableSamplersMaxDescriptorCount;
@@ -64,6 +64,8 @@ const char *GetCommandString(CommandID id)
             return "CopyImage";
         case CommandID::CopyImageToBuffer:
             return "CopyImageToBuffer";
+        case CommandID::CopyQueryPoolResults:
+            return "CopyQueryPoolResults";
         case CommandID::Dispatch:
             return "Dispatch";
         case CommandID::DispatchIndirect:
@@ -110,6 +112,8 @@ const char *GetCommandString(CommandID id)
             return "PipelineBarrier";
         case CommandID::PushConstants:
             return "PushConstants";
+        case CommandID::PushDescriptorSet:
+            return "PushDescriptorSet";
         case CommandID::ResetEvent:
             return "ResetEvent";
         case CommandID::ResetQueryPool:
@@ -400,6 +404,15 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                                            params->dstBuffer, 1, &params->region);
                     break;
                 }
+                case CommandID::CopyQueryPoolResults:
+                {
+                    const CopyQueryPoolResultsParams *params =
+                        getParamPtr<CopyQueryPoolResultsParams>(currentCommand);
+                    vkCmdCopyQueryPoolResults(cmdBuffer, params->queryPool, params->firstQuery,
+                                              params->queryCount, params->dstBuffer,
+                                              params->dstOffset, params->stride, params->flags);
+                    break;
+                }
                 case CommandID::Dispatch:
                 {
                     const DispatchParams *params = getParamPtr<DispatchParams>(currentCommand);
@@ -654,6 +667,48 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                                        params->size, data);
                     break;
                 }
+                case CommandID::PushDescriptorSet:
+                {
+                    const PushDescriptorSetParams *params =
+                        getParamPtr<PushDescriptorSetParams>(currentCommand);
+                    ASSERT(params->descriptorWriteCount <= kMaxPushDescriptorCount);
+
+                    std::array<VkWriteDescriptorSet, kMaxPushDescriptorCount> writes;
+                    const PushDescriptorWrite *packedWrite =
+                        GetFirstArrayParameter<PushDescriptorWrite>(params);
+                    for (uint32_t writeIndex = 0; writeIndex < params->descriptorWriteCount;
+                         ++writeIndex)
+                    {
+                        VkWriteDescriptorSet &write = writes[writeIndex];
+                        write                       = {};
+                        write.sType                 = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                        write.dstBinding            = packedWrite->binding;
+                        write.dstArrayElement       = packedWrite->arrayElement;
+                        write.descriptorCount       = packedWrite->descriptorCount;
+                        write.descriptorType =
+                            static_cast<VkDescriptorType>(packedWrite->descriptorType);
+
+                        if (IsTexelBufferDescriptor(write.descriptorType))
+                        {
+                            write.pTexelBufferView =
+                                GetNextArrayParameter<VkBufferView>(packedWrite, 1);
+                            packedWrite = GetNextArrayParameter<PushDescriptorWrite>(
+                                write.pTexelBufferView, write.descriptorCount);
+                        }
+                        else
+                        {
+                            write.pImageInfo =
+                                GetNextArrayParameter<VkDescriptorImageInfo>(packedWrite, 1);
+                            packedWrite = GetNextArrayParameter<PushDescriptorWrite>(
+                                write.pImageInfo, write.descriptorCount);
+                        }
+                    }
+
+                    vkCmdPushDescriptorSetKHR(cmdBuffer, params->pipelineBindPoint, params->layout,
+                                              params->set, params->descriptorWriteCount,
+                                              writes.data());
+                    break;
+                }
                 case CommandID::ResetEvent:
                 {
                     const ResetEventParams *params = getParamPtr<ResetEventParams>(currentCommand);
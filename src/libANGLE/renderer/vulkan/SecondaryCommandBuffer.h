@@ -60,6 +60,7 @@ enum class CommandID : uint16_t
     CopyBufferToImage,
     CopyImage,
     CopyImageToBuffer,
+    CopyQueryPoolResults,
     Dispatch,
     DispatchIndirect,
     Draw,
@@ -86,6 +87,7 @@ enum class CommandID : uint16_t
     PipelineBarrier,
     PipelineBarrier2,
     PushConstants,
+    PushDescriptorSet,
     ResetEvent,
     ResetQueryPool,
     ResolveImage,
@@ -298,6 +300,21 @@ struct CopyImageToBufferParams
 };
 VERIFY_8_BYTE_ALIGNMENT(CopyImageToBufferParams)
 
+struct CopyQueryPoolResultsParams
+{
+    CommandHeader header;
+
+    uint32_t firstQuery : 24;
+    uint32_t queryCount : 8;
+    VkQueryPool queryPool;
+    VkBuffer dstBuffer;
+    VkDeviceSize dstOffset;
+    VkDeviceSize stride;
+    VkQueryResultFlags flags;
+    uint32_t padding;
+};
+VERIFY_8_BYTE_ALIGNMENT(CopyQueryPoolResultsParams)
+
 // This is a common struct used by both begin & insert DebugUtilsLabelEXT() functions
 struct DebugUtilsLabelParams
 {
@@ -549,6 +566,29 @@ struct PushConstantsParams
 };
 VERIFY_8_BYTE_ALIGNMENT(PushConstantsParams)
 
+struct PushDescriptorSetParams
+{
+    CommandHeader header;
+
+    VkPipelineBindPoint pipelineBindPoint : 8;
+    uint32_t set : 8;
+    uint32_t descriptorWriteCount : 16;
+
+    VkPipelineLayout layout;
+};
+VERIFY_8_BYTE_ALIGNMENT(PushDescriptorSetParams)
+
+// The writes of a PushDescriptorSet command follow its params.  Each write is stored as a
+// PushDescriptorWrite followed by its descriptorCount VkDescriptorImageInfos or VkBufferViews.
+struct PushDescriptorWrite
+{
+    uint16_t binding;
+    uint16_t arrayElement;
+    uint16_t descriptorCount;
+    uint16_t descriptorType;
+};
+VERIFY_8_BYTE_ALIGNMENT(PushDescriptorWrite)
+
 struct ResetEventParams
 {
     CommandHeader header;
@@ -936,6 +976,14 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                            uint32_t regionCount,
                            const VkBufferImageCopy *regions);
 
+    void copyQueryPoolResults(const QueryPool &queryPool,
+                              uint32_t firstQuery,
+                              uint32_t queryCount,
+                              const Buffer &dstBuffer,
+                              VkDeviceSize dstOffset,
+                              VkDeviceSize stride,
+                              VkQueryResultFlags flags);
+
     void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
 
     void dispatchIndirect(const Buffer &buffer, VkDeviceSize offset);
@@ -1029,6 +1077,12 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                        uint32_t size,
                        const void *data);
 
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           DescriptorSetIndex set,
+                           uint32_t descriptorWriteCount,
+                           const VkWriteDescriptorSet *descriptorWrites);
+
     void resetEvent(VkEvent event, VkPipelineStageFlags stageMask);
 
     void resetQueryPool(const QueryPool &queryPool, uint32_t firstQuery, uint32_t queryCount);
@@ -1586,6 +1640,25 @@ ANGLE_INLINE void SecondaryCommandBuffer::copyImageToBuffer(const Image &srcImag
     paramStruct->region         = regions[0];
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::copyQueryPoolResults(const QueryPool &queryPool,
+                                                               uint32_t firstQuery,
+                                                               uint32_t queryCount,
+                                                               const Buffer &dstBuffer,
+                                                               VkDeviceSize dstOffset,
+                                                               VkDeviceSize stride,
+                                                               VkQueryResultFlags flags)
+{
+    CopyQueryPoolResultsParams *paramStruct =
+        initCommand<CopyQueryPoolResultsParams>(CommandID::CopyQueryPoolResults);
+    paramStruct->queryPool = queryPool.getHandle();
+    SetBitField(paramStruct->firstQuery, firstQuery);
+    SetBitField(paramStruct->queryCount, queryCount);
+    paramStruct->dstBuffer = dstBuffer.getHandle();
+    paramStruct->dstOffset = dstOffset;
+    paramStruct->stride    = stride;
+    paramStruct->flags     = flags;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::dispatch(uint32_t groupCountX,
                                                    uint32_t groupCountY,
                                                    uint32_t groupCountZ)
@@ -1958,6 +2031,70 @@ ANGLE_INLINE void SecondaryCommandBuffer::pushConstants(const PipelineLayout &la
     storeArrayParameter(writePtr, data, dataSize);
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::pushDescriptorSet(
+    const PipelineLayout &layout,
+    VkPipelineBindPoint pipelineBindPoint,
+    DescriptorSetIndex set,
+    uint32_t descriptorWriteCount,
+    const VkWriteDescriptorSet *descriptorWrites)
+{
+    ASSERT(descriptorWriteCount <= kMaxPushDescriptorCount);
+
+    // Only image and texel buffer descriptors are pushed.
+    const ArrayParamSize writeSize = calculateArrayParameterSize<PushDescriptorWrite>(1);
+    size_t variableSize            = writeSize.allocateBytes * descriptorWriteCount;
+    for (uint32_t writeIndex = 0; writeIndex < descriptorWriteCount; ++writeIndex)
+    {
+        const VkWriteDescriptorSet &write = descriptorWrites[writeIndex];
+        ASSERT(write.pBufferInfo == nullptr);
+        if (IsTexelBufferDescriptor(write.descriptorType))
+        {
+            variableSize +=
+                calculateArrayParameterSize<VkBufferView>(write.descriptorCount).allocateBytes;
+        }
+        else
+        {
+            variableSize += calculateArrayParameterSize<VkDescriptorImageInfo>(
+                                write.descriptorCount)
+                                .allocateBytes;
+        }
+    }
+
+    uint8_t *writePtr;
+    PushDescriptorSetParams *paramStruct = initCommand<PushDescriptorSetParams>(
+        CommandID::PushDescriptorSet, variableSize, &writePtr);
+    paramStruct->layout = layout.getHandle();
+    SetBitField(paramStruct->pipelineBindPoint, pipelineBindPoint);
+    SetBitField(paramStruct->set, ToUnderlying(set));
+    SetBitField(paramStruct->descriptorWriteCount, descriptorWriteCount);
+
+    // Copy variable sized data
+    for (uint32_t writeIndex = 0; writeIndex < descriptorWriteCount; ++writeIndex)
+    {
+        const VkWriteDescriptorSet &write = descriptorWrites[writeIndex];
+
+        PushDescriptorWrite packedWrite;
+        SetBitField(packedWrite.binding, write.dstBinding);
+        SetBitField(packedWrite.arrayElement, write.dstArrayElement);
+        SetBitField(packedWrite.descriptorCount, write.descriptorCount);
+        SetBitField(packedWrite.descriptorType, write.descriptorType);
+        writePtr = storeArrayParameter(writePtr, &packedWrite, writeSize);
+
+        if (IsTexelBufferDescriptor(write.descriptorType))
+        {
+            writePtr = storeArrayParameter(
+                writePtr, write.pTexelBufferView,
+                calculateArrayParameterSize<VkBufferView>(write.descriptorCount));
+        }
+        else
+        {
+            writePtr = storeArrayParameter(
+                writePtr, write.pImageInfo,
+                calculateArrayParameterSize<VkDescriptorImageInfo>(write.descriptorCount));
+        }
+    }
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::resetEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     ResetEventParams *paramStruct = initCommand<ResetEventParams>(CommandID::ResetEvent);
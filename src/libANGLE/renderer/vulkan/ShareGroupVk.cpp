@@ -66,7 +66,9 @@ ShareGroupVk::ShareGroupVk(const egl::ShareGroupState &state, vk::Renderer *rend
       mCurrentFrameCount(0),
       mContextsPriority(egl::ContextPriority::InvalidEnum),
       mIsContextsPriorityLocked(false),
-      mLastMonolithicPipelineJobTime(0)
+      mLastMonolithicPipelineJobTime(0),
+      mIsRecordingSpeculativeBufferReadbacks(false),
+      mIsSubmittingDeferredUnMakeCurrentCommands(false)
 {
     mLastPruneTime = angle::GetCurrentSystemTime();
 }
@@ -192,6 +194,121 @@ void ShareGroupVk::onTextureRelease(TextureVk *textureVk)
     mTextureUpload.onTextureRelease(textureVk);
 }
 
+void ShareGroupVk::onBufferReadbackPredicted(BufferVk *bufferVk)
+{
+    ASSERT(std::find(mReadbackPredictedBuffers.begin(), mReadbackPredictedBuffers.end(),
+                     bufferVk) == mReadbackPredictedBuffers.end());
+    mReadbackPredictedBuffers.push_back(bufferVk);
+}
+
+void ShareGroupVk::onBufferReadbackNotPredicted(BufferVk *bufferVk)
+{
+    ASSERT(!mIsRecordingSpeculativeBufferReadbacks);
+    auto iter =
+        std::find(mReadbackPredictedBuffers.begin(), mReadbackPredictedBuffers.end(), bufferVk);
+    ASSERT(iter != mReadbackPredictedBuffers.end());
+    *iter = mReadbackPredictedBuffers.back();
+    mReadbackPredictedBuffers.pop_back();
+}
+
+angle::Result ShareGroupVk::recordSpeculativeBufferReadbacks(ContextVk *contextVk)
+{
+    if (mReadbackPredictedBuffers.empty() || mIsRecordingSpeculativeBufferReadbacks)
+    {
+        return angle::Result::Continue;
+    }
+
+    mIsRecordingSpeculativeBufferReadbacks = true;
+    angle::Result result                   = angle::Result::Continue;
+
+    size_t index = 0;
+    while (index < mReadbackPredictedBuffers.size())
+    {
+        bool keepPredicting = true;
+        result = mReadbackPredictedBuffers[index]->recordSpeculativeReadback(contextVk,
+                                                                             &keepPredicting);
+        if (result != angle::Result::Continue)
+        {
+            break;
+        }
+
+        if (keepPredicting)
+        {
+            ++index;
+        }
+        else
+        {
+            mReadbackPredictedBuffers[index] = mReadbackPredictedBuffers.back();
+            mReadbackPredictedBuffers.pop_back();
+        }
+    }
+
+    mIsRecordingSpeculativeBufferReadbacks = false;
+    return result;
+}
+
+void ShareGroupVk::onDeferredUnMakeCurrentSubmission(ContextVk *contextVk)
+{
+    ASSERT(std::find(mContextsWithDeferredUnMakeCurrentSubmission.begin(),
+                     mContextsWithDeferredUnMakeCurrentSubmission.end(),
+                     contextVk) == mContextsWithDeferredUnMakeCurrentSubmission.end());
+    mContextsWithDeferredUnMakeCurrentSubmission.push_back(contextVk);
+}
+
+void ShareGroupVk::onDeferredUnMakeCurrentSubmissionDone(ContextVk *contextVk)
+{
+    auto iter = std::find(mContextsWithDeferredUnMakeCurrentSubmission.begin(),
+                          mContextsWithDeferredUnMakeCurrentSubmission.end(), contextVk);
+    ASSERT(iter != mContextsWithDeferredUnMakeCurrentSubmission.end());
+    mContextsWithDeferredUnMakeCurrentSubmission.erase(iter);
+}
+
+bool ShareGroupVk::hasDeferredUnMakeCurrentUse(const vk::ResourceUse &use) const
+{
+    for (const ContextVk *contextVk : mContextsWithDeferredUnMakeCurrentSubmission)
+    {
+        if (contextVk->hasUnsubmittedUseInThisContext(use))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+angle::Result ShareGroupVk::submitDeferredUnMakeCurrentCommands(ContextVk *contextVk)
+{
+    // Submitting a context's commands calls back into this function; the outer call takes care of
+    // the rest of the list.
+    if (mContextsWithDeferredUnMakeCurrentSubmission.empty() ||
+        mIsSubmittingDeferredUnMakeCurrentCommands)
+    {
+        return angle::Result::Continue;
+    }
+
+    // Submit in the order the contexts were made uncurrent, which is the order their commands were
+    // recorded in.  If |contextVk| itself has a deferred submission, only the contexts before it
+    // are submitted, as its own commands are submitted next.
+    mIsSubmittingDeferredUnMakeCurrentCommands = true;
+    angle::Result result                       = angle::Result::Continue;
+
+    while (!mContextsWithDeferredUnMakeCurrentSubmission.empty() &&
+           mContextsWithDeferredUnMakeCurrentSubmission.front() != contextVk)
+    {
+        ContextVk *deferredContextVk = mContextsWithDeferredUnMakeCurrentSubmission.front();
+        mContextsWithDeferredUnMakeCurrentSubmission.erase(
+            mContextsWithDeferredUnMakeCurrentSubmission.begin());
+
+        result = deferredContextVk->submitDeferredUnMakeCurrentCommands();
+        if (result != angle::Result::Continue)
+        {
+            break;
+        }
+    }
+
+    mIsSubmittingDeferredUnMakeCurrentCommands = false;
+    return result;
+}
+
 angle::Result ShareGroupVk::scheduleMonolithicPipelineCreationTask(
     ContextVk *contextVk,
     vk::WaitableMonolithicPipelineCreationTask *taskOut)
@@ -284,9 +401,19 @@ void TextureUpload::onTextureRelease(TextureVk *textureVk)
 
 void ShareGroupVk::onFramebufferBoundary()
 {
-    if (isDueForBufferPoolPrune())
+    // Sample the memory budget once per frame. If any heap is getting close to its budget, prune
+    // the buffer pools right away so that empty blocks are freed and the rest are repacked.
+    bool isNearMemoryBudget = false;
+    if (mRenderer->getFeatures().budgetAwareAllocation.enabled)
+    {
+        MemoryAllocationTracker *memoryAllocationTracker = mRenderer->getMemoryAllocationTracker();
+        memoryAllocationTracker->updateMemoryBudget();
+        isNearMemoryBudget = memoryAllocationTracker->isAnyHeapNearMemoryBudget();
+    }
+
+    if (isNearMemoryBudget || isDueForBufferPoolPrune())
     {
-        pruneDefaultBufferPools();
+        pruneDefaultBufferPools(isNearMemoryBudget);
     }
 
     // Always clean up event garbage and destroy the excessive free list at frame boundary.
@@ -317,12 +444,13 @@ vk::BufferPool *ShareGroupVk::getDefaultBufferPool(VkDeviceSize size,
     return mDefaultBufferPools[memoryTypeIndex].get();
 }
 
-void ShareGroupVk::pruneDefaultBufferPools()
+void ShareGroupVk::pruneDefaultBufferPools(bool isNearMemoryBudget)
 {
     mLastPruneTime = angle::GetCurrentSystemTime();
 
-    // Bail out if no suballocation have been destroyed since last prune.
-    if (mRenderer->getSuballocationDestroyedSize() == 0)
+    // Bail out if no suballocation have been destroyed since last prune. When memory is tight,
+    // the pools are still pruned to release the empty buffers they keep around for reuse.
+    if (mRenderer->getSuballocationDestroyedSize() == 0 && !isNearMemoryBudget)
     {
         return;
     }
@@ -64,7 +64,7 @@ class ShareGroupVk : public ShareGroupImpl
                                          uint32_t memoryTypeIndex,
                                          BufferUsageType usageType);
 
-    void pruneDefaultBufferPools();
+    void pruneDefaultBufferPools(bool isNearMemoryBudget);
 
     void calculateTotalBufferCount(size_t *bufferCount, VkDeviceSize *totalSize) const;
     void logBufferPools() const;
@@ -81,6 +81,28 @@ class ShareGroupVk : public ShareGroupImpl
 
     void onTextureRelease(TextureVk *textureVk);
 
+    // Device local buffers that are expected to be mapped for reading.  They are copied to host
+    // cached memory right before the commands that write to them are submitted.
+    void onBufferReadbackPredicted(BufferVk *bufferVk);
+    void onBufferReadbackNotPredicted(BufferVk *bufferVk);
+    angle::Result recordSpeculativeBufferReadbacks(ContextVk *contextVk);
+
+    // Contexts that are no longer current, but whose submission was deferred on a switch to
+    // another context of the share group.  Any context of the share group submits them before its
+    // own commands.
+    void onDeferredUnMakeCurrentSubmission(ContextVk *contextVk);
+    void onDeferredUnMakeCurrentSubmissionDone(ContextVk *contextVk);
+    bool hasDeferredUnMakeCurrentSubmissions() const
+    {
+        return !mContextsWithDeferredUnMakeCurrentSubmission.empty();
+    }
+    bool isLastDeferredUnMakeCurrentSubmission(const ContextVk *contextVk) const
+    {
+        return mContextsWithDeferredUnMakeCurrentSubmission.back() == contextVk;
+    }
+    bool hasDeferredUnMakeCurrentUse(const vk::ResourceUse &use) const;
+    angle::Result submitDeferredUnMakeCurrentCommands(ContextVk *contextVk);
+
     angle::Result scheduleMonolithicPipelineCreationTask(
         ContextVk *contextVk,
         vk::WaitableMonolithicPipelineCreationTask *taskOut);
@@ -150,6 +172,15 @@ class ShareGroupVk : public ShareGroupImpl
     // Texture update manager used to flush uploaded mutable textures.
     TextureUpload mTextureUpload;
 
+    // Buffers to speculatively read back on submission.  Recording the copies may end the render
+    // pass and flush, so reentrant calls are ignored.
+    std::vector<BufferVk *> mReadbackPredictedBuffers;
+    bool mIsRecordingSpeculativeBufferReadbacks;
+
+    // Contexts with deferred submissions, in the order they were made uncurrent.
+    std::vector<ContextVk *> mContextsWithDeferredUnMakeCurrentSubmission;
+    bool mIsSubmittingDeferredUnMakeCurrentCommands;
+
     // Holds RefCountedEvent that are free and ready to reuse
     vk::RefCountedEventsGarbageRecycler mRefCountedEventsGarbageRecycler;
 };
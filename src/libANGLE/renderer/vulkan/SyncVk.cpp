@@ -305,7 +305,7 @@ angle::Result SyncHelper::submitSyncIfDeferred(ContextVk *contextVk, RenderPassC
     for (auto context : contextVk->getShareGroup()->getContexts())
     {
         ContextVk *sharedContextVk = vk::GetImpl(context.second);
-        if (sharedContextVk->hasUnsubmittedUse(mUse))
+        if (sharedContextVk->hasUnsubmittedUseInThisContext(mUse))
         {
             ANGLE_TRY(sharedContextVk->flushCommandsAndEndRenderPassIfDeferredSyncInit(reason));
             break;
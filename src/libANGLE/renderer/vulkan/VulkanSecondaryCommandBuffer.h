@@ -104,6 +104,13 @@ class VulkanSecondaryCommandBuffer : public priv::CommandBuffer
                            VkBuffer dstBuffer,
                            uint32_t regionCount,
                            const VkBufferImageCopy *regions);
+    void copyQueryPoolResults(const QueryPool &queryPool,
+                              uint32_t firstQuery,
+                              uint32_t queryCount,
+                              const Buffer &dstBuffer,
+                              VkDeviceSize dstOffset,
+                              VkDeviceSize stride,
+                              VkQueryResultFlags flags);
     void copyImage(const Image &srcImage,
                    VkImageLayout srcImageLayout,
                    const Image &dstImage,
@@ -383,6 +390,19 @@ ANGLE_INLINE void VulkanSecondaryCommandBuffer::copyImageToBuffer(const Image &s
     CommandBuffer::copyImageToBuffer(srcImage, srcImageLayout, dstBuffer, regionCount, regions);
 }
 
+ANGLE_INLINE void VulkanSecondaryCommandBuffer::copyQueryPoolResults(const QueryPool &queryPool,
+                                                                     uint32_t firstQuery,
+                                                                     uint32_t queryCount,
+                                                                     const Buffer &dstBuffer,
+                                                                     VkDeviceSize dstOffset,
+                                                                     VkDeviceSize stride,
+                                                                     VkQueryResultFlags flags)
+{
+    onRecordCommand();
+    CommandBuffer::copyQueryPoolResults(queryPool, firstQuery, queryCount, dstBuffer, dstOffset,
+                                        stride, flags);
+}
+
 ANGLE_INLINE void VulkanSecondaryCommandBuffer::copyImage(const Image &srcImage,
                                                           VkImageLayout srcImageLayout,
                                                           const Image &dstImage,
@@ -1333,6 +1333,7 @@ class SpirvInactiveVaryingRemover final : angle::NonCopyable
         spirv::IdRefList *interfaceList);
 
     bool isInactive(spirv::IdRef id) const { return mIsInactiveById[id]; }
+    bool hasInactiveOutputs() const { return mHasInactiveOutputs; }
 
     spirv::IdRef getTransformedPrivateType(spirv::IdRef id) const
     {
@@ -1349,6 +1350,7 @@ class SpirvInactiveVaryingRemover final : angle::NonCopyable
 
     // Whether a variable has been marked inactive.
     std::vector<bool> mIsInactiveById;
+    bool mHasInactiveOutputs = false;
 };
 
 void SpirvInactiveVaryingRemover::init(size_t indexBound)
@@ -1479,6 +1481,7 @@ TransformationState SpirvInactiveVaryingRemover::transformVariable(spirv::IdResu
                          nullptr);
 
     mIsInactiveById[id] = true;
+    mHasInactiveOutputs = mHasInactiveOutputs || storageClass == spv::StorageClassOutput;
 
     return TransformationState::Transformed;
 }
@@ -3461,6 +3464,8 @@ class SpirvTransformer final : public SpirvTransformerBase
 
     void transform();
 
+    bool hasInactiveOutputs() const { return mInactiveVaryingRemover.hasInactiveOutputs(); }
+
   private:
     // A prepass to resolve interesting ids:
     void resolveVariableIds();
@@ -5421,6 +5426,556 @@ void SpirvVertexAttributeAliasingTransformer::writeExpandedMatrixInitialization(
         spirv::WriteStore(mSpirvBlobOut, matrixId, compositeId, nullptr);
     }
 }
+
+// A transformation that removes code whose result is never observed.  This runs after inactive
+// varyings are turned into Private variables by SpirvTransformer, at which point the stores to
+// those variables, the computations that only feed them and the resources (such as uniforms and
+// samplers) that are no longer referenced as a result are all dead.
+//
+// The analysis is deliberately conservative.  Only instructions known to be free of side effects
+// are removed, and every operand word of any other instruction is considered a potential id use.
+class SpirvDeadCodeEliminator final : public SpirvTransformerBase
+{
+  public:
+    SpirvDeadCodeEliminator(const spirv::Blob &spirvBlobIn,
+                            const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                            spirv::Blob *spirvBlobOut)
+        : SpirvTransformerBase(spirvBlobIn, variableInfoMap, spirvBlobOut)
+    {}
+
+    void transform();
+
+  private:
+    // Analysis passes:
+    void findVariablesAndReads();
+    void countUses();
+    void removeUnusedResults();
+
+    // Transform instructions:
+    void transformInstruction();
+    TransformationState transformEntryPoint(const uint32_t *instruction);
+
+    // Helpers:
+    bool isPure(spv::Op opCode, const uint32_t *instruction, uint32_t wordCount) const;
+    bool isVariable(uint32_t id) const;
+    bool isRemovableVariable(uint32_t id) const;
+    spirv::IdRef getRootVariable(uint32_t id) const;
+    bool isDeadStore(const uint32_t *instruction) const;
+    void markRead(uint32_t id);
+    uint32_t getFirstUseWord(spv::Op opCode, const uint32_t *instruction, uint32_t wordCount) const;
+
+    // The id of the GLSL.std.450 extended instruction set, whose instructions have no side effects.
+    spirv::IdRef mGlslStd450Id;
+
+    // Storage class of each variable, or StorageClassMax if the id is not a variable.
+    std::vector<spv::StorageClass> mVariableStorageClassById;
+    // For pointers created by Op*AccessChain, the variable they are derived from.
+    std::vector<spirv::IdRef> mRootVariableById;
+    // Whether the contents of a variable are ever read.  Stores to Private and Function variables
+    // that are never read are dead.
+    std::vector<bool> mIsVariableReadById;
+    // Whether the id is the result of an instruction that has no side effects.
+    std::vector<bool> mIsPureResultById;
+    // The word offset of the pure instruction that defines each id, used to release its operands
+    // when it is removed.
+    std::vector<uint32_t> mDefiningWordById;
+    std::vector<uint32_t> mUseCountById;
+    std::vector<bool> mIsRemovedById;
+};
+
+void SpirvDeadCodeEliminator::transform()
+{
+    onTransformBegin();
+
+    findVariablesAndReads();
+    countUses();
+    removeUnusedResults();
+
+    while (mCurrentWord < mSpirvBlobIn.size())
+    {
+        transformInstruction();
+    }
+}
+
+void SpirvDeadCodeEliminator::findVariablesAndReads()
+{
+    const uint32_t indexBound = mSpirvBlobIn[spirv::kHeaderIndexIndexBound];
+
+    mVariableStorageClassById.resize(indexBound, spv::StorageClassMax);
+    mRootVariableById.resize(indexBound);
+    mIsVariableReadById.resize(indexBound, false);
+    mIsPureResultById.resize(indexBound, false);
+    mDefiningWordById.resize(indexBound, 0);
+
+    bool isInFunctionSection = false;
+    size_t currentWord       = spirv::kHeaderIndexInstructions;
+
+    while (currentWord < mSpirvBlobIn.size())
+    {
+        const uint32_t *instruction = &mSpirvBlobIn[currentWord];
+
+        uint32_t wordCount;
+        spv::Op opCode;
+        spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+        switch (opCode)
+        {
+            case spv::OpExtInstImport:
+            {
+                spirv::IdResult id;
+                spirv::LiteralString name;
+                spirv::ParseExtInstImport(instruction, &id, &name);
+                if (strcmp(name, "GLSL.std.450") == 0)
+                {
+                    mGlslStd450Id = id;
+                }
+                break;
+            }
+            case spv::OpFunction:
+                isInFunctionSection = true;
+                break;
+            case spv::OpVariable:
+            {
+                spirv::IdResultType typeId;
+                spirv::IdResult id;
+                spv::StorageClass storageClass;
+                spirv::ParseVariable(instruction, &typeId, &id, &storageClass, nullptr);
+                mVariableStorageClassById[id] = storageClass;
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (isInFunctionSection)
+        {
+            if (isPure(opCode, instruction, wordCount))
+            {
+                const uint32_t id = instruction[2];
+                ASSERT(id < indexBound);
+                mIsPureResultById[id] = true;
+                mDefiningWordById[id] = static_cast<uint32_t>(currentWord);
+            }
+
+            if (opCode == spv::OpAccessChain || opCode == spv::OpInBoundsAccessChain)
+            {
+                // Taking a pointer to part of a variable is not a read, but the indices are.
+                const spirv::IdRef id(instruction[2]);
+                const spirv::IdRef baseId(instruction[3]);
+                mRootVariableById[id] = getRootVariable(baseId);
+
+                for (uint32_t wordIndex = 4; wordIndex < wordCount; ++wordIndex)
+                {
+                    markRead(instruction[wordIndex]);
+                }
+            }
+            else if (opCode == spv::OpStore)
+            {
+                // Storing to a variable is not a read of it.
+                markRead(instruction[2]);
+            }
+            else
+            {
+                // Any other use of a pointer is conservatively considered a read.  SPIR-V requires
+                // definitions to dominate their uses (which the block order reflects), so the
+                // access chains are already visited.
+                for (uint32_t wordIndex = getFirstUseWord(opCode, instruction, wordCount);
+                     wordIndex < wordCount; ++wordIndex)
+                {
+                    markRead(instruction[wordIndex]);
+                }
+            }
+        }
+
+        currentWord += wordCount;
+    }
+}
+
+void SpirvDeadCodeEliminator::countUses()
+{
+    const uint32_t indexBound = mSpirvBlobIn[spirv::kHeaderIndexIndexBound];
+    mUseCountById.resize(indexBound, 0);
+
+    bool isInFunctionSection = false;
+    size_t currentWord       = spirv::kHeaderIndexInstructions;
+
+    // Only uses inside functions are counted.  Debug and annotation instructions are removed along
+    // with their target, and OpEntryPoint is adjusted to not list removed variables.
+    while (currentWord < mSpirvBlobIn.size())
+    {
+        const uint32_t *instruction = &mSpirvBlobIn[currentWord];
+
+        uint32_t wordCount;
+        spv::Op opCode;
+        spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+        isInFunctionSection = isInFunctionSection || opCode == spv::OpFunction;
+
+        if (isInFunctionSection && !(opCode == spv::OpStore && isDeadStore(instruction)))
+        {
+            for (uint32_t wordIndex = getFirstUseWord(opCode, instruction, wordCount);
+                 wordIndex < wordCount; ++wordIndex)
+            {
+                const uint32_t id = instruction[wordIndex];
+                if (id < indexBound)
+                {
+                    ++mUseCountById[id];
+                }
+            }
+        }
+
+        currentWord += wordCount;
+    }
+}
+
+void SpirvDeadCodeEliminator::removeUnusedResults()
+{
+    const uint32_t indexBound = mSpirvBlobIn[spirv::kHeaderIndexIndexBound];
+    mIsRemovedById.resize(indexBound, false);
+
+    std::vector<uint32_t> unusedIds;
+    for (uint32_t id = 1; id < indexBound; ++id)
+    {
+        if (mUseCountById[id] == 0 && (mIsPureResultById[id] || isRemovableVariable(id)))
+        {
+            unusedIds.push_back(id);
+        }
+    }
+
+    // Remove unused results, and transitively the results that were only used by them.
+    while (!unusedIds.empty())
+    {
+        const uint32_t id = unusedIds.back();
+        unusedIds.pop_back();
+
+        ASSERT(!mIsRemovedById[id]);
+        mIsRemovedById[id] = true;
+
+        if (!mIsPureResultById[id])
+        {
+            continue;
+        }
+
+        const uint32_t *instruction = &mSpirvBlobIn[mDefiningWordById[id]];
+
+        uint32_t wordCount;
+        spv::Op opCode;
+        spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+        for (uint32_t wordIndex = getFirstUseWord(opCode, instruction, wordCount);
+             wordIndex < wordCount; ++wordIndex)
+        {
+            const uint32_t operandId = instruction[wordIndex];
+            if (operandId >= indexBound)
+            {
+                continue;
+            }
+
+            ASSERT(mUseCountById[operandId] > 0);
+            if (--mUseCountById[operandId] == 0 &&
+                (mIsPureResultById[operandId] || isRemovableVariable(operandId)))
+            {
+                unusedIds.push_back(operandId);
+            }
+        }
+    }
+}
+
+void SpirvDeadCodeEliminator::transformInstruction()
+{
+    uint32_t wordCount;
+    spv::Op opCode;
+    const uint32_t *instruction = getCurrentInstruction(&opCode, &wordCount);
+
+    if (opCode == spv::OpFunction)
+    {
+        // SPIR-V is structured in sections.  Function declarations come last.
+        mIsInFunctionSection = true;
+    }
+
+    TransformationState transformationState = TransformationState::Unchanged;
+
+    if (mIsInFunctionSection)
+    {
+        if (opCode == spv::OpStore)
+        {
+            transformationState = isDeadStore(instruction) ? TransformationState::Transformed
+                                                           : TransformationState::Unchanged;
+        }
+        else if (opCode == spv::OpVariable || isPure(opCode, instruction, wordCount))
+        {
+            transformationState = mIsRemovedById[instruction[2]]
+                                      ? TransformationState::Transformed
+                                      : TransformationState::Unchanged;
+        }
+    }
+    else
+    {
+        switch (opCode)
+        {
+            case spv::OpEntryPoint:
+                transformationState = transformEntryPoint(instruction);
+                break;
+            case spv::OpName:
+            case spv::OpDecorate:
+                // Drop debug info and decorations of removed ids.
+                transformationState = mIsRemovedById[instruction[1]]
+                                          ? TransformationState::Transformed
+                                          : TransformationState::Unchanged;
+                break;
+            case spv::OpVariable:
+                transformationState = mIsRemovedById[instruction[2]]
+                                          ? TransformationState::Transformed
+                                          : TransformationState::Unchanged;
+                break;
+            default:
+                break;
+        }
+    }
+
+    // If the instruction was not transformed, copy it to output as is.
+    if (transformationState == TransformationState::Unchanged)
+    {
+        copyInstruction(instruction, wordCount);
+    }
+
+    // Advance to next instruction.
+    mCurrentWord += wordCount;
+}
+
+TransformationState SpirvDeadCodeEliminator::transformEntryPoint(const uint32_t *instruction)
+{
+    spv::ExecutionModel executionModel;
+    spirv::IdRef entryPointId;
+    spirv::LiteralString name;
+    spirv::IdRefList interfaceList;
+    spirv::ParseEntryPoint(instruction, &executionModel, &entryPointId, &name, &interfaceList);
+
+    // Since SPIR-V 1.4, removed global variables are also listed in the interface.
+    size_t writeIndex = 0;
+    for (size_t index = 0; index < interfaceList.size(); ++index)
+    {
+        if (!mIsRemovedById[interfaceList[index]])
+        {
+            interfaceList[writeIndex++] = interfaceList[index];
+        }
+    }
+
+    if (writeIndex == interfaceList.size())
+    {
+        return TransformationState::Unchanged;
+    }
+
+    interfaceList.resize_down(writeIndex);
+    spirv::WriteEntryPoint(mSpirvBlobOut, executionModel, entryPointId, name, interfaceList);
+
+    return TransformationState::Transformed;
+}
+
+bool SpirvDeadCodeEliminator::isPure(spv::Op opCode,
+                                     const uint32_t *instruction,
+                                     uint32_t wordCount) const
+{
+    switch (opCode)
+    {
+        case spv::OpLoad:
+            // Volatile loads are kept.
+            return wordCount < 5 || (instruction[4] & spv::MemoryAccessVolatileMask) == 0;
+        case spv::OpExtInst:
+            return mGlslStd450Id.valid() && instruction[3] == mGlslStd450Id;
+        case spv::OpUndef:
+        case spv::OpPhi:
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpVectorExtractDynamic:
+        case spv::OpVectorInsertDynamic:
+        case spv::OpVectorShuffle:
+        case spv::OpCompositeConstruct:
+        case spv::OpCompositeExtract:
+        case spv::OpCompositeInsert:
+        case spv::OpCopyObject:
+        case spv::OpTranspose:
+        case spv::OpSampledImage:
+        case spv::OpImageSampleImplicitLod:
+        case spv::OpImageSampleExplicitLod:
+        case spv::OpImageSampleDrefImplicitLod:
+        case spv::OpImageSampleDrefExplicitLod:
+        case spv::OpImageSampleProjImplicitLod:
+        case spv::OpImageSampleProjExplicitLod:
+        case spv::OpImageSampleProjDrefImplicitLod:
+        case spv::OpImageSampleProjDrefExplicitLod:
+        case spv::OpImageFetch:
+        case spv::OpImageGather:
+        case spv::OpImageDrefGather:
+        case spv::OpImageRead:
+        case spv::OpImage:
+        case spv::OpImageQuerySizeLod:
+        case spv::OpImageQuerySize:
+        case spv::OpImageQueryLod:
+        case spv::OpImageQueryLevels:
+        case spv::OpImageQuerySamples:
+        case spv::OpConvertFToU:
+        case spv::OpConvertFToS:
+        case spv::OpConvertSToF:
+        case spv::OpConvertUToF:
+        case spv::OpUConvert:
+        case spv::OpSConvert:
+        case spv::OpFConvert:
+        case spv::OpQuantizeToF16:
+        case spv::OpBitcast:
+        case spv::OpSNegate:
+        case spv::OpFNegate:
+        case spv::OpIAdd:
+        case spv::OpFAdd:
+        case spv::OpISub:
+        case spv::OpFSub:
+        case spv::OpIMul:
+        case spv::OpFMul:
+        case spv::OpUDiv:
+        case spv::OpSDiv:
+        case spv::OpFDiv:
+        case spv::OpUMod:
+        case spv::OpSRem:
+        case spv::OpSMod:
+        case spv::OpFRem:
+        case spv::OpFMod:
+        case spv::OpVectorTimesScalar:
+        case spv::OpMatrixTimesScalar:
+        case spv::OpVectorTimesMatrix:
+        case spv::OpMatrixTimesVector:
+        case spv::OpMatrixTimesMatrix:
+        case spv::OpOuterProduct:
+        case spv::OpDot:
+        case spv::OpIAddCarry:
+        case spv::OpISubBorrow:
+        case spv::OpUMulExtended:
+        case spv::OpSMulExtended:
+        case spv::OpAny:
+        case spv::OpAll:
+        case spv::OpIsNan:
+        case spv::OpIsInf:
+        case spv::OpLogicalEqual:
+        case spv::OpLogicalNotEqual:
+        case spv::OpLogicalOr:
+        case spv::OpLogicalAnd:
+        case spv::OpLogicalNot:
+        case spv::OpSelect:
+        case spv::OpIEqual:
+        case spv::OpINotEqual:
+        case spv::OpUGreaterThan:
+        case spv::OpSGreaterThan:
+        case spv::OpUGreaterThanEqual:
+        case spv::OpSGreaterThanEqual:
+        case spv::OpULessThan:
+        case spv::OpSLessThan:
+        case spv::OpULessThanEqual:
+        case spv::OpSLessThanEqual:
+        case spv::OpFOrdEqual:
+        case spv::OpFUnordEqual:
+        case spv::OpFOrdNotEqual:
+        case spv::OpFUnordNotEqual:
+        case spv::OpFOrdLessThan:
+        case spv::OpFUnordLessThan:
+        case spv::OpFOrdGreaterThan:
+        case spv::OpFUnordGreaterThan:
+        case spv::OpFOrdLessThanEqual:
+        case spv::OpFUnordLessThanEqual:
+        case spv::OpFOrdGreaterThanEqual:
+        case spv::OpFUnordGreaterThanEqual:
+        case spv::OpShiftRightLogical:
+        case spv::OpShiftRightArithmetic:
+        case spv::OpShiftLeftLogical:
+        case spv::OpBitwiseOr:
+        case spv::OpBitwiseXor:
+        case spv::OpBitwiseAnd:
+        case spv::OpNot:
+        case spv::OpBitFieldInsert:
+        case spv::OpBitFieldSExtract:
+        case spv::OpBitFieldUExtract:
+        case spv::OpBitReverse:
+        case spv::OpBitCount:
+        case spv::OpDPdx:
+        case spv::OpDPdy:
+        case spv::OpFwidth:
+        case spv::OpDPdxFine:
+        case spv::OpDPdyFine:
+        case spv::OpFwidthFine:
+        case spv::OpDPdxCoarse:
+        case spv::OpDPdyCoarse:
+        case spv::OpFwidthCoarse:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool SpirvDeadCodeEliminator::isVariable(uint32_t id) const
+{
+    ASSERT(id < mVariableStorageClassById.size());
+    return mVariableStorageClassById[id] != spv::StorageClassMax;
+}
+
+bool SpirvDeadCodeEliminator::isRemovableVariable(uint32_t id) const
+{
+    ASSERT(id < mVariableStorageClassById.size());
+    // Input and Output variables are part of the stage interface and are always kept.
+    switch (mVariableStorageClassById[id])
+    {
+        case spv::StorageClassPrivate:
+        case spv::StorageClassFunction:
+        case spv::StorageClassUniform:
+        case spv::StorageClassUniformConstant:
+        case spv::StorageClassStorageBuffer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+spirv::IdRef SpirvDeadCodeEliminator::getRootVariable(uint32_t id) const
+{
+    return isVariable(id) ? spirv::IdRef(id) : mRootVariableById[id];
+}
+
+bool SpirvDeadCodeEliminator::isDeadStore(const uint32_t *instruction) const
+{
+    const spirv::IdRef rootId = getRootVariable(instruction[1]);
+    if (!rootId.valid() || mIsVariableReadById[rootId])
+    {
+        return false;
+    }
+
+    const spv::StorageClass storageClass = mVariableStorageClassById[rootId];
+    return storageClass == spv::StorageClassPrivate || storageClass == spv::StorageClassFunction;
+}
+
+void SpirvDeadCodeEliminator::markRead(uint32_t id)
+{
+    if (id >= mRootVariableById.size())
+    {
+        return;
+    }
+
+    const spirv::IdRef rootId = getRootVariable(id);
+    if (rootId.valid())
+    {
+        mIsVariableReadById[rootId] = true;
+    }
+}
+
+uint32_t SpirvDeadCodeEliminator::getFirstUseWord(spv::Op opCode,
+                                                  const uint32_t *instruction,
+                                                  uint32_t wordCount) const
+{
+    // Pure instructions all have a result type and id, which are followed by the operands.  The
+    // only operand of OpVariable that may be an id is its initializer.  For other instructions,
+    // every word is a potential id use.
+    if (opCode == spv::OpVariable)
+    {
+        return 4;
+    }
+    return isPure(opCode, instruction, wordCount) ? 3 : 1;
+}
 }  // anonymous namespace
 
 SpvSourceOptions SpvCreateSourceOptions(const angle::FeaturesVk &features,
@@ -5655,6 +6210,14 @@ angle::Result SpvTransformSpirvCode(const SpvTransformOptions &options,
         aliasingTransformer.transform();
     }
 
+    // If outputs were found to be inactive, remove the code that only existed to calculate them.
+    if (options.removeDeadCode && transformer.hasInactiveOutputs())
+    {
+        spirv::Blob preTransformBlob = std::move(*spirvBlobOut);
+        SpirvDeadCodeEliminator deadCodeEliminator(preTransformBlob, variableInfoMap, spirvBlobOut);
+        deadCodeEliminator.transform();
+    }
+
     spirvBlobOut->shrink_to_fit();
 
     if (options.validate)
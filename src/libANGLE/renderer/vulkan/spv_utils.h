@@ -53,6 +53,7 @@ struct SpvTransformOptions
     bool validate                       = true;
     bool useSpirvVaryingPrecisionFixer  = false;
     bool removeDepthStencilInput        = false;
+    bool removeDeadCode                 = false;
 };
 
 struct ShaderInterfaceVariableXfbInfo
@@ -4924,7 +4924,7 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs)
 
 // DescriptorSetLayoutDesc implementation.
 DescriptorSetLayoutDesc::DescriptorSetLayoutDesc()
-    : mImmutableSamplers{}, mDescriptorSetLayoutBindings{}
+    : mImmutableSamplers{}, mDescriptorSetLayoutBindings{}, mFlags(0)
 {}
 
 DescriptorSetLayoutDesc::~DescriptorSetLayoutDesc() = default;
@@ -4955,13 +4955,13 @@ size_t DescriptorSetLayoutDesc::hash() const
                                                  validImmutableSamplersCount * sizeof(VkSampler));
     }
 
-    return genericHash;
+    return genericHash ^ mFlags;
 }
 
 bool DescriptorSetLayoutDesc::operator==(const DescriptorSetLayoutDesc &other) const
 {
     return mDescriptorSetLayoutBindings == other.mDescriptorSetLayoutBindings &&
-           mImmutableSamplers == other.mImmutableSamplers;
+           mImmutableSamplers == other.mImmutableSamplers && mFlags == other.mFlags;
 }
 
 void DescriptorSetLayoutDesc::addBinding(uint32_t bindingIndex,
@@ -7380,13 +7380,17 @@ uint32_t UpdateDescriptorSetsBuilder::flushDescriptorSetUpdates(VkDevice device)
     }
 
     uint32_t totalSize = mWriteDescriptorSets.updateDescriptorSets(device);
+    discardDescriptorSetUpdates();
+
+    return totalSize;
+}
 
+void UpdateDescriptorSetsBuilder::discardDescriptorSetUpdates()
+{
     mWriteDescriptorSets.clear();
     mDescriptorBufferInfos.clear();
     mDescriptorImageInfos.clear();
     mBufferViews.clear();
-
-    return totalSize;
 }
 
 // FramebufferCache implementation.
@@ -8463,7 +8467,7 @@ angle::Result DescriptorSetLayoutCache::getDescriptorSetLayout(
 
     VkDescriptorSetLayoutCreateInfo createInfo = {};
     createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    createInfo.flags        = 0;
+    createInfo.flags        = desc.getFlags();
     createInfo.bindingCount = static_cast<uint32_t>(bindingVector.size());
     createInfo.pBindings    = bindingVector.data();
 
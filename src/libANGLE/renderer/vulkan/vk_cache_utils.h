@@ -1201,6 +1201,11 @@ class DescriptorSetLayoutDesc final
 
     void unpackBindings(DescriptorSetLayoutBindingVector *bindings) const;
 
+    // Layouts with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR are never allocated from
+    // a pool; their descriptors are pushed to the command buffer instead.
+    void setPushDescriptor() { mFlags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR; }
+    VkDescriptorSetLayoutCreateFlags getFlags() const { return mFlags; }
+
     bool empty() const { return mDescriptorSetLayoutBindings.empty(); }
 
   private:
@@ -1233,7 +1238,8 @@ class DescriptorSetLayoutDesc final
     angle::FastVector<PackedDescriptorSetBinding, kDefaultDescriptorSetLayoutBindingsCount>
         mDescriptorSetLayoutBindings;
 
-#if !defined(ANGLE_IS_64_BIT_CPU)
+    VkDescriptorSetLayoutCreateFlags mFlags;
+#if defined(ANGLE_IS_64_BIT_CPU)
     ANGLE_MAYBE_UNUSED_PRIVATE_FIELD uint32_t mPadding = 0;
 #endif
 };
@@ -3011,6 +3017,9 @@ class UpdateDescriptorSetsBuilder final : angle::NonCopyable
 
     // Returns the number of written descriptor sets.
     uint32_t flushDescriptorSetUpdates(VkDevice device);
+    // Drops the pending writes without updating any descriptor set.  Used when the builder only
+    // holds writes that are pushed to the command buffer.
+    void discardDescriptorSetUpdates();
 
   private:
     // Manage the storage for VkDescriptorBufferInfo and VkDescriptorImageInfo. The storage is not
@@ -12,6 +12,7 @@
 
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
+#include "common/vulkan/vk_headers.h"
 
 namespace rx
 {
@@ -34,6 +35,17 @@ ANGLE_INLINE ProtectionType ConvertProtectionBoolToType(bool isProtected)
     return (isProtected ? ProtectionType::Protected : ProtectionType::Unprotected);
 }
 
+// maxPushDescriptors is only guaranteed to be at least 32.  ANGLE never pushes more descriptors
+// than that in one vkCmdPushDescriptorSetKHR call, which also lets a recorded push be replayed from
+// a fixed-size array.
+constexpr uint32_t kMaxPushDescriptorCount = 32;
+
+ANGLE_INLINE bool IsTexelBufferDescriptor(VkDescriptorType descriptorType)
+{
+    return descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER ||
+           descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+}
+
 // A helper class to track commands recorded to a command buffer.
 class CommandBufferCommandTracker
 {
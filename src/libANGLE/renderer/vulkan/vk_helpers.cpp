@@ -1333,6 +1333,20 @@ class [[nodiscard]] ScopedOverrideYCbCrFilter final
     ImageHelper *mImage;
     VkFilter mOriginalFilter;
 };
+
+bool IsSameImageSubresourceRange(const VkImageMemoryBarrier &a, const VkImageMemoryBarrier &b)
+{
+    return a.image == b.image && a.subresourceRange.aspectMask == b.subresourceRange.aspectMask &&
+           a.subresourceRange.baseMipLevel == b.subresourceRange.baseMipLevel &&
+           a.subresourceRange.levelCount == b.subresourceRange.levelCount &&
+           a.subresourceRange.baseArrayLayer == b.subresourceRange.baseArrayLayer &&
+           a.subresourceRange.layerCount == b.subresourceRange.layerCount;
+}
+
+bool IsQueueFamilyOwnershipTransfer(const VkImageMemoryBarrier &barrier)
+{
+    return barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex;
+}
 }  // anonymous namespace
 
 // This is an arbitrary max. We can change this later if necessary.
@@ -1818,6 +1832,7 @@ void CommandBufferHelperCommon::resetImpl(ErrorContext *context)
     ASSERT(!mAcquireNextImageSemaphore.valid());
     mCommandAllocator.resetAllocator();
     ASSERT(!mIsAnyHostVisibleBufferWritten);
+    mUsesImageSharedAcrossShareGroups = false;
 
     ASSERT(mRefCountedEvents.empty());
     ASSERT(mRefCountedEventCollector.empty());
@@ -2024,9 +2039,20 @@ void CommandBufferHelperCommon::updateImageLayoutAndBarrier(Context *context,
     }
 }
 
+void CommandBufferHelperCommon::onImageUse(const ImageHelper &image)
+{
+    // Remember the use of images that other share groups may use, so the context doesn't defer the
+    // submission of these commands.
+    if (image.isSharedAcrossShareGroups())
+    {
+        mUsesImageSharedAcrossShareGroups = true;
+    }
+}
+
 void CommandBufferHelperCommon::retainImageWithEvent(Context *context, ImageHelper *image)
 {
     image->setQueueSerial(mQueueSerial);
+    onImageUse(*image);
     image->updatePipelineStageAccessHistory();
 
     if (context->getFeatures().useVkEventForImageBarrier.enabled)
@@ -2152,6 +2178,7 @@ void OutsideRenderPassCommandBufferHelper::retainImage(ImageHelper *image)
     // We want explicit control on when VkEvent is used for outsideRPCommands to minimize the
     // overhead, so do not setEvent here.
     image->setQueueSerial(mQueueSerial);
+    onImageUse(*image);
     image->updatePipelineStageAccessHistory();
 }
 
@@ -2331,6 +2358,7 @@ RenderPassCommandBufferHelper::RenderPassCommandBufferHelper()
       mCounter(0),
       mClearValues{},
       mRenderPassStarted(false),
+      mHasScissoredLoadOpClears(false),
       mTransformFeedbackCounterBuffers{},
       mTransformFeedbackCounterBufferOffsets{},
       mValidTransformFeedbackBufferCount(0),
@@ -2382,6 +2410,7 @@ angle::Result RenderPassCommandBufferHelper::reset(
     mFragmentShadingRateAtachment.reset();
 
     mRenderPassStarted                     = false;
+    mHasScissoredLoadOpClears              = false;
     mValidTransformFeedbackBufferCount     = 0;
     mRebindTransformFeedbackBuffers        = false;
     mHasShaderStorageOutput                = false;
@@ -2444,6 +2473,7 @@ void RenderPassCommandBufferHelper::colorImagesDraw(gl::LevelIndex level,
     ASSERT(packedAttachmentIndex < mColorAttachmentsCount);
 
     image->onRenderPassAttach(mQueueSerial);
+    onImageUse(*image);
 
     mColorAttachments[packedAttachmentIndex].init(image, imageSiblingSerial, level, layerStart,
                                                   layerCount, VK_IMAGE_ASPECT_COLOR_BIT);
@@ -2451,6 +2481,7 @@ void RenderPassCommandBufferHelper::colorImagesDraw(gl::LevelIndex level,
     if (resolveImage)
     {
         resolveImage->onRenderPassAttach(mQueueSerial);
+        onImageUse(*resolveImage);
         mColorResolveAttachments[packedAttachmentIndex].init(resolveImage, imageSiblingSerial,
                                                              level, layerStart, layerCount,
                                                              VK_IMAGE_ASPECT_COLOR_BIT);
@@ -2471,6 +2502,7 @@ void RenderPassCommandBufferHelper::depthStencilImagesDraw(gl::LevelIndex level,
     // defer the image layout changes until endRenderPass time or when images going away so that we
     // only insert layout change barrier once.
     image->onRenderPassAttach(mQueueSerial);
+    onImageUse(*image);
 
     mDepthAttachment.init(image, imageSiblingSerial, level, layerStart, layerCount,
                           VK_IMAGE_ASPECT_DEPTH_BIT);
@@ -2483,6 +2515,7 @@ void RenderPassCommandBufferHelper::depthStencilImagesDraw(gl::LevelIndex level,
         // depth/stencil image as currently it can only ever come from
         // multisampled-render-to-texture renderbuffers.
         resolveImage->onRenderPassAttach(mQueueSerial);
+        onImageUse(*resolveImage);
 
         mDepthResolveAttachment.init(resolveImage, imageSiblingSerial, level, layerStart,
                                      layerCount, VK_IMAGE_ASPECT_DEPTH_BIT);
@@ -2497,6 +2530,7 @@ void RenderPassCommandBufferHelper::fragmentShadingRateImageRead(ImageHelper *im
     ASSERT(!usesImage(*image));
 
     image->onRenderPassAttach(mQueueSerial);
+    onImageUse(*image);
 
     // Initialize RenderPassAttachment for fragment shading rate attachment.
     mFragmentShadingRateAtachment.init(image, {}, gl::LevelIndex(0), 0, 1,
@@ -3239,7 +3273,7 @@ void RenderPassCommandBufferHelper::invalidateRenderPassStencilAttachment(
                                   getRenderPassWriteCommandCount());
 }
 
-angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
+angle::Result RenderPassCommandBufferHelper::flushToPrimary(ErrorContext *context,
                                                             CommandsState *commandsState,
                                                             const RenderPass &renderPass,
                                                             VkFramebuffer framebufferOverride)
@@ -3352,6 +3386,7 @@ void RenderPassCommandBufferHelper::addColorResolveAttachment(size_t colorIndexG
     ASSERT(mColorResolveAttachments[packedAttachmentIndex].getImage() == nullptr);
 
     image->onRenderPassAttach(mQueueSerial);
+    onImageUse(*image);
     mColorResolveAttachments[packedAttachmentIndex].init(
         image, imageSiblingSerial, level, layerStart, layerCount, VK_IMAGE_ASPECT_COLOR_BIT);
 }
@@ -3376,6 +3411,7 @@ void RenderPassCommandBufferHelper::addDepthStencilResolveAttachment(
     }
 
     image->onRenderPassAttach(mQueueSerial);
+    onImageUse(*image);
     mDepthResolveAttachment.init(image, imageSiblingSerial, level, layerStart, layerCount,
                                  VK_IMAGE_ASPECT_DEPTH_BIT);
     mStencilResolveAttachment.init(image, imageSiblingSerial, level, layerStart, layerCount,
@@ -3439,6 +3475,14 @@ void RenderPassCommandBufferHelper::updateRenderPassDepthStencilClear(
 void RenderPassCommandBufferHelper::growRenderArea(ContextVk *contextVk,
                                                    const gl::Rectangle &newRenderArea)
 {
+    ASSERT(canGrowRenderArea(newRenderArea));
+
+    // loadOp=Clear only applies to the current render area, so clear it explicitly instead.
+    if (mHasScissoredLoadOpClears && !mRenderArea.encloses(newRenderArea))
+    {
+        convertScissoredLoadOpClearsToClearAttachments(contextVk);
+    }
+
     // The render area is grown such that it covers both the previous and the new render areas.
     gl::GetEnclosingRectangle(mRenderArea, newRenderArea, &mRenderArea);
 
@@ -3447,6 +3491,95 @@ void RenderPassCommandBufferHelper::growRenderArea(ContextVk *contextVk,
     mStencilAttachment.onRenderAreaGrowth(contextVk, mRenderArea);
 }
 
+bool RenderPassCommandBufferHelper::canGrowRenderArea(const gl::Rectangle &newRenderArea)
+{
+    return !mHasScissoredLoadOpClears || mRenderArea.encloses(newRenderArea) ||
+           getCommandBuffer().empty();
+}
+
+void RenderPassCommandBufferHelper::convertScissoredLoadOpClearsToClearAttachments(
+    ContextVk *contextVk)
+{
+    // Nothing has been recorded in the render pass yet, so clearing the attachments at this point
+    // is equivalent to loadOp=Clear over the current render area.
+    ASSERT(getCommandBuffer().empty());
+    ASSERT(!mRenderPassDesc.isRenderToTexture());
+
+    gl::AttachmentVector<VkClearAttachment> attachments;
+
+    PackedAttachmentIndex colorIndexVk(0);
+    for (size_t colorIndexGL = 0; colorIndexGL < mRenderPassDesc.colorAttachmentRange();
+         ++colorIndexGL)
+    {
+        if (!mRenderPassDesc.isColorAttachmentEnabled(colorIndexGL))
+        {
+            continue;
+        }
+
+        PackedAttachmentOpsDesc &ops = mAttachmentOps[colorIndexVk];
+        if (static_cast<RenderPassLoadOp>(ops.loadOp) == RenderPassLoadOp::Clear)
+        {
+            // With render pass objects, the clears are indexed by the subpass-mapped locations.
+            // With dynamic rendering, they are indexed by the actual attachment index.
+            const uint32_t clearAttachmentIndex =
+                contextVk->getFeatures().preferDynamicRendering.enabled
+                    ? colorIndexVk.get()
+                    : static_cast<uint32_t>(colorIndexGL);
+
+            attachments.emplace_back(VkClearAttachment{
+                VK_IMAGE_ASPECT_COLOR_BIT, clearAttachmentIndex, mClearValues[colorIndexVk]});
+            SetBitField(ops.loadOp, RenderPassLoadOp::Load);
+            onColorAccess(colorIndexVk, ResourceAccess::ReadWrite);
+            ++contextVk->getPerfCounters().colorClearAttachments;
+        }
+        ++colorIndexVk;
+    }
+
+    if (mDepthStencilAttachmentIndex != kAttachmentIndexInvalid)
+    {
+        PackedAttachmentOpsDesc &dsOps   = mAttachmentOps[mDepthStencilAttachmentIndex];
+        VkImageAspectFlags dsAspectFlags = 0;
+
+        if (static_cast<RenderPassLoadOp>(dsOps.loadOp) == RenderPassLoadOp::Clear)
+        {
+            dsAspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+            SetBitField(dsOps.loadOp, RenderPassLoadOp::Load);
+            onDepthAccess(ResourceAccess::ReadWrite);
+            ++contextVk->getPerfCounters().depthClearAttachments;
+        }
+        if (static_cast<RenderPassLoadOp>(dsOps.stencilLoadOp) == RenderPassLoadOp::Clear)
+        {
+            dsAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+            SetBitField(dsOps.stencilLoadOp, RenderPassLoadOp::Load);
+            onStencilAccess(ResourceAccess::ReadWrite);
+            ++contextVk->getPerfCounters().stencilClearAttachments;
+        }
+
+        if (dsAspectFlags != 0)
+        {
+            attachments.emplace_back(
+                VkClearAttachment{dsAspectFlags, 0, mClearValues[mDepthStencilAttachmentIndex]});
+        }
+    }
+
+    mHasScissoredLoadOpClears = false;
+
+    if (attachments.empty())
+    {
+        return;
+    }
+
+    VkClearRect rect        = {};
+    rect.rect.offset.x      = mRenderArea.x;
+    rect.rect.offset.y      = mRenderArea.y;
+    rect.rect.extent.width  = mRenderArea.width;
+    rect.rect.extent.height = mRenderArea.height;
+    rect.layerCount         = mRenderPassDesc.viewCount() > 0 ? 1 : mFramebuffer.getLayers();
+
+    getCommandBuffer().clearAttachments(static_cast<uint32_t>(attachments.size()),
+                                        attachments.data(), 1, &rect);
+}
+
 angle::Result RenderPassCommandBufferHelper::attachCommandPool(ErrorContext *context,
                                                                SecondaryCommandPool *commandPool)
 {
@@ -4021,6 +4154,16 @@ void BufferPool::pruneEmptyBuffers(Renderer *renderer)
         mBufferBlocks.resize(nonEmptyBufferCount);
     }
 
+    // When the heap is close to its budget, don't keep any empty buffers around, and reorder the
+    // blocks so that new suballocations (which are made from the back of the list) are packed into
+    // the fullest blocks. This gives the sparsely used blocks a chance to become empty and be
+    // freed, instead of spreading allocations over every block in the pool.
+    const bool isNearMemoryBudget = renderer->isMemoryTypeNearBudget(mMemoryTypeIndex, 0);
+    if (isNearMemoryBudget)
+    {
+        sortBufferBlocksByUsage();
+    }
+
     // Decide how many empty buffers to keep around and trim down the excessive empty buffers. We
     // keep track of how many buffers are needed since last prune. Assume we are in stable state,
     // which means we may still need that many empty buffers in next prune cycle. To reduce chance
@@ -4029,8 +4172,10 @@ void BufferPool::pruneEmptyBuffers(Renderer *renderer)
     // we will trim excessive empty buffers at next prune call. Or if we underestimate, we will end
     // up have to call into vulkan driver allocate new buffers, but next cycle we should correct
     // ourselves to keep enough number of empty buffers around.
-    size_t buffersToKeep = std::min(mNumberOfNewBuffersNeededSinceLastPrune,
-                                    static_cast<size_t>(kMaxTotalEmptyBufferBytes / mSize));
+    size_t buffersToKeep =
+        isNearMemoryBudget ? 0
+                           : std::min(mNumberOfNewBuffersNeededSinceLastPrune,
+                                      static_cast<size_t>(kMaxTotalEmptyBufferBytes / mSize));
     while (mEmptyBufferBlocks.size() > buffersToKeep)
     {
         std::unique_ptr<BufferBlock> &block = mEmptyBufferBlocks.back();
@@ -4041,6 +4186,26 @@ void BufferPool::pruneEmptyBuffers(Renderer *renderer)
     mNumberOfNewBuffersNeededSinceLastPrune = 0;
 }
 
+void BufferPool::sortBufferBlocksByUsage()
+{
+    std::vector<std::pair<VkDeviceSize, BufferBlockPointer>> blocksByUsage;
+    blocksByUsage.reserve(mBufferBlocks.size());
+    for (BufferBlockPointer &block : mBufferBlocks)
+    {
+        vma::StatInfo statInfo;
+        block->calculateStats(&statInfo);
+        blocksByUsage.emplace_back(statInfo.basicInfo.allocationBytes, std::move(block));
+    }
+
+    std::stable_sort(blocksByUsage.begin(), blocksByUsage.end(),
+                     [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    for (size_t blockIndex = 0; blockIndex < blocksByUsage.size(); ++blockIndex)
+    {
+        mBufferBlocks[blockIndex] = std::move(blocksByUsage[blockIndex].second);
+    }
+}
+
 VkResult BufferPool::allocateNewBuffer(ErrorContext *context, VkDeviceSize sizeInBytes)
 {
     Renderer *renderer         = context->getRenderer();
@@ -4976,7 +5141,9 @@ DynamicallyGrowingPool<Pool>::PoolResource::PoolResource(PoolResource &&other)
 {}
 
 // DynamicQueryPool implementation
-DynamicQueryPool::DynamicQueryPool() = default;
+DynamicQueryPool::DynamicQueryPool()
+    : mQueryType(VK_QUERY_TYPE_OCCLUSION), mCopyResultsToBuffer(false)
+{}
 
 DynamicQueryPool::~DynamicQueryPool() = default;
 
@@ -4987,11 +5154,28 @@ angle::Result DynamicQueryPool::init(ContextVk *contextVk, VkQueryType type, uin
 
     ANGLE_TRY(initEntryPool(contextVk, poolSize));
     mQueryType = type;
+    mCopyResultsToBuffer =
+        type == VK_QUERY_TYPE_OCCLUSION &&
+        contextVk->getFeatures().copyOcclusionQueryResultsToBuffer.enabled;
     return angle::Result::Continue;
 }
 
+void DynamicQueryPool::destroy(Renderer *renderer)
+{
+    for (BufferHelper &resultBuffer : mResultBuffers)
+    {
+        resultBuffer.destroy(renderer);
+    }
+    mResultBuffers.clear();
+    mResultCopySerials.clear();
+    mPendingResultCopies.clear();
+
+    destroyEntryPool(renderer->getDevice());
+}
+
 void DynamicQueryPool::destroy(VkDevice device)
 {
+    ASSERT(mResultBuffers.empty());
     destroyEntryPool(device);
 }
 
@@ -5012,6 +5196,13 @@ angle::Result DynamicQueryPool::allocateQuery(ContextVk *contextVk,
 
     queryOut->init(this, currentPool, queryIndex, queryCount);
 
+    if (mCopyResultsToBuffer)
+    {
+        // Forget about the copies made for previous users of these queries.
+        const size_t firstSlot = currentPool * getPoolSize() + queryIndex;
+        std::fill_n(mResultCopySerials.begin() + firstSlot, queryCount, QueueSerial());
+    }
+
     return angle::Result::Continue;
 }
 
@@ -5031,10 +5222,94 @@ angle::Result DynamicQueryPool::allocatePoolImpl(ContextVk *contextVk,
         queryPoolInfo.pipelineStatistics = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT;
     }
 
+    if (mCopyResultsToBuffer)
+    {
+        VkBufferCreateInfo createInfo = {};
+        createInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.size               = entriesToAllocate * sizeof(uint64_t);
+        createInfo.usage              = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        createInfo.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+        BufferHelper resultBuffer;
+        ANGLE_TRY(resultBuffer.init(
+            contextVk, createInfo,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT));
+        uint8_t *mappedMemory = nullptr;
+        ANGLE_TRY(resultBuffer.map(contextVk, &mappedMemory));
+
+        // The new pool is appended to the pool list, so its buffer goes at the same index.
+        mResultBuffers.push_back(std::move(resultBuffer));
+        mResultCopySerials.resize(mResultCopySerials.size() + entriesToAllocate);
+    }
+
     ANGLE_VK_TRY(contextVk, poolToAllocate.init(contextVk->getDevice(), queryPoolInfo));
     return angle::Result::Continue;
 }
 
+void DynamicQueryPool::onRenderPassQueryEnded(size_t poolIndex, uint32_t query, uint32_t queryCount)
+{
+    ASSERT(mCopyResultsToBuffer);
+
+    if (!mPendingResultCopies.empty())
+    {
+        PendingResultCopy &lastCopy = mPendingResultCopies.back();
+        if (lastCopy.poolIndex == poolIndex && lastCopy.query + lastCopy.queryCount == query)
+        {
+            lastCopy.queryCount += queryCount;
+            return;
+        }
+    }
+
+    mPendingResultCopies.push_back({poolIndex, query, queryCount});
+}
+
+void DynamicQueryPool::flushPendingResultCopies(OutsideRenderPassCommandBuffer *commandBuffer,
+                                                const QueueSerial &queueSerial)
+{
+    ASSERT(queueSerial.valid());
+
+    for (const PendingResultCopy &copy : mPendingResultCopies)
+    {
+        const BufferHelper &resultBuffer = mResultBuffers[copy.poolIndex];
+        commandBuffer->copyQueryPoolResults(
+            getQueryPool(copy.poolIndex), copy.query, copy.queryCount, resultBuffer.getBuffer(),
+            resultBuffer.getOffset() + copy.query * sizeof(uint64_t), sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+
+        const size_t firstSlot = copy.poolIndex * getPoolSize() + copy.query;
+        std::fill_n(mResultCopySerials.begin() + firstSlot, copy.queryCount, queueSerial);
+    }
+    mPendingResultCopies.clear();
+}
+
+const QueueSerial &DynamicQueryPool::getResultCopySerial(size_t poolIndex, uint32_t query) const
+{
+    ASSERT(mCopyResultsToBuffer);
+    return mResultCopySerials[poolIndex * getPoolSize() + query];
+}
+
+void DynamicQueryPool::getCopiedResults(Renderer *renderer,
+                                        size_t poolIndex,
+                                        uint32_t query,
+                                        uint32_t queryCount,
+                                        QueryResult *resultOut)
+{
+    ASSERT(renderer->hasQueueSerialFinished(getResultCopySerial(poolIndex, query)));
+
+    BufferHelper &resultBuffer = mResultBuffers[poolIndex];
+    if (!resultBuffer.isCoherent())
+    {
+        (void)resultBuffer.invalidate(renderer, query * sizeof(uint64_t),
+                                      queryCount * sizeof(uint64_t));
+    }
+
+    std::array<uint64_t, gl::IMPLEMENTATION_ANGLE_MULTIVIEW_MAX_VIEWS> results;
+    ASSERT(queryCount <= results.size());
+    memcpy(results.data(), resultBuffer.getMappedMemory() + query * sizeof(uint64_t),
+           queryCount * sizeof(uint64_t));
+    resultOut->setResults(results.data(), queryCount);
+}
+
 void DynamicQueryPool::freeQuery(ContextVk *contextVk, QueryHelper *query)
 {
     if (query->valid())
@@ -5103,7 +5378,7 @@ QueryHelper &QueryHelper::operator=(QueryHelper &&rhs)
     return *this;
 }
 
-void QueryHelper::init(const DynamicQueryPool *dynamicQueryPool,
+void QueryHelper::init(DynamicQueryPool *dynamicQueryPool,
                        const size_t queryPoolIndex,
                        uint32_t query,
                        uint32_t queryCount)
@@ -5219,6 +5494,11 @@ void QueryHelper::endRenderPassQuery(ContextVk *contextVk)
     {
         endQueryImpl(contextVk, &contextVk->getStartedRenderPassCommands().getCommandBuffer());
         contextVk->getStartedRenderPassCommands().retainResource(this);
+
+        if (mDynamicQueryPool->copiesResultsToBuffer())
+        {
+            mDynamicQueryPool->onRenderPassQueryEnded(mQueryPoolIndex, mQuery, mQueryCount);
+        }
     }
 }
 
@@ -5260,6 +5540,19 @@ bool QueryHelper::hasSubmittedCommands() const
     return mUse.valid();
 }
 
+const QueueSerial &QueryHelper::getResultCopySerial() const
+{
+    return mDynamicQueryPool->getResultCopySerial(mQueryPoolIndex, mQuery);
+}
+
+bool QueryHelper::hasCopiedResults(ContextVk *contextVk) const
+{
+    // The copy is only used once submitted; until then, the results are read from the query pool
+    // directly.
+    return mDynamicQueryPool->copiesResultsToBuffer() && getResultCopySerial().valid() &&
+           contextVk->getRenderer()->hasQueueSerialSubmitted(getResultCopySerial());
+}
+
 angle::Result QueryHelper::getUint64ResultNonBlocking(ContextVk *contextVk,
                                                       QueryResult *resultOut,
                                                       bool *availableOut)
@@ -5267,6 +5560,26 @@ angle::Result QueryHelper::getUint64ResultNonBlocking(ContextVk *contextVk,
     ASSERT(valid());
     VkResult result;
 
+    if (hasCopiedResults(contextVk))
+    {
+        // Polling only needs to check whether the copy has finished, which is a fence check shared
+        // by all queries in the submission.
+        Renderer *renderer            = contextVk->getRenderer();
+        const QueueSerial &copySerial = getResultCopySerial();
+        if (!renderer->hasQueueSerialFinished(copySerial))
+        {
+            ANGLE_TRY(renderer->checkCompletedCommandsAndCleanup(contextVk));
+        }
+
+        *availableOut = renderer->hasQueueSerialFinished(copySerial);
+        if (*availableOut)
+        {
+            mDynamicQueryPool->getCopiedResults(renderer, mQueryPoolIndex, mQuery, mQueryCount,
+                                                resultOut);
+        }
+        return angle::Result::Continue;
+    }
+
     // Ensure that we only wait if we have inserted a query in command buffer. Otherwise you will
     // wait forever and trigger GPU timeout.
     if (hasSubmittedCommands())
@@ -5296,7 +5609,14 @@ angle::Result QueryHelper::getUint64ResultNonBlocking(ContextVk *contextVk,
 angle::Result QueryHelper::getUint64Result(ContextVk *contextVk, QueryResult *resultOut)
 {
     ASSERT(valid());
-    if (hasSubmittedCommands())
+    if (hasCopiedResults(contextVk))
+    {
+        Renderer *renderer = contextVk->getRenderer();
+        ANGLE_TRY(renderer->finishQueueSerial(contextVk, getResultCopySerial()));
+        mDynamicQueryPool->getCopiedResults(renderer, mQueryPoolIndex, mQuery, mQueryCount,
+                                            resultOut);
+    }
+    else if (hasSubmittedCommands())
     {
         constexpr VkQueryResultFlags kFlags = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT;
         ANGLE_VK_TRY(contextVk, getResultImpl(contextVk, kFlags, resultOut));
@@ -5378,11 +5698,64 @@ void PipelineBarrier::addDiagnosticsString(std::ostringstream &out) const
     }
 }
 
+void PipelineBarrier::addImageBarrier(const VkImageMemoryBarrier &imageMemoryBarrier)
+{
+    // A queue family ownership release or acquire is kept exactly as recorded.  Merging it with
+    // another barrier of the same image would drop one side of the transfer.
+    if (IsQueueFamilyOwnershipTransfer(imageMemoryBarrier))
+    {
+        mImageMemoryBarriers.push_back(imageMemoryBarrier);
+        return;
+    }
+
+    // A barrier that doesn't transition the layout and has no writes to make available (for
+    // example, between shader reads from different stages) is only an execution dependency plus a
+    // visibility operation.  The global memory barrier covers that, so drop the image barrier.
+    if (imageMemoryBarrier.oldLayout == imageMemoryBarrier.newLayout &&
+        imageMemoryBarrier.srcAccessMask == 0 && imageMemoryBarrier.dstAccessMask != 0)
+    {
+        mMemoryBarrierDstAccess |= imageMemoryBarrier.dstAccessMask;
+        return;
+    }
+
+    for (VkImageMemoryBarrier &existing : mImageMemoryBarriers)
+    {
+        if (!IsSameImageSubresourceRange(existing, imageMemoryBarrier) ||
+            IsQueueFamilyOwnershipTransfer(existing) ||
+            existing.srcQueueFamilyIndex != imageMemoryBarrier.srcQueueFamilyIndex)
+        {
+            continue;
+        }
+
+        // Neither barrier transfers ownership and both are on the same queue family.  All image
+        // barriers of a vkCmdPipelineBarrier call execute at the same point, so a duplicate only
+        // needs its access masks combined, and a transition that continues from another one
+        // (A->B followed by B->C) is collapsed into a single A->C transition.
+        ASSERT(existing.dstQueueFamilyIndex == imageMemoryBarrier.dstQueueFamilyIndex);
+        if (existing.oldLayout == imageMemoryBarrier.oldLayout &&
+            existing.newLayout == imageMemoryBarrier.newLayout)
+        {
+            existing.srcAccessMask |= imageMemoryBarrier.srcAccessMask;
+            existing.dstAccessMask |= imageMemoryBarrier.dstAccessMask;
+            return;
+        }
+        if (existing.newLayout == imageMemoryBarrier.oldLayout)
+        {
+            existing.newLayout     = imageMemoryBarrier.newLayout;
+            existing.dstAccessMask = imageMemoryBarrier.dstAccessMask;
+            return;
+        }
+    }
+
+    mImageMemoryBarriers.push_back(imageMemoryBarrier);
+}
+
 // PipelineBarrierArray implementation.
 void PipelineBarrierArray::execute(Renderer *renderer, PrimaryCommandBuffer *primary)
 {
     // make a local copy for faster access
     PipelineStagesMask mask = mBarrierMask;
+    mRequestedBarrierCount  = 0;
     if (mask.none())
     {
         return;
@@ -5409,6 +5782,24 @@ void PipelineBarrierArray::execute(Renderer *renderer, PrimaryCommandBuffer *pri
     mBarrierMask.reset();
 }
 
+uint32_t PipelineBarrierArray::getPipelineBarrierCallCount(Renderer *renderer) const
+{
+    uint32_t callCount = 0;
+    for (PipelineStage pipelineStage : mBarrierMask)
+    {
+        if (!mBarriers[pipelineStage].isEmpty())
+        {
+            ++callCount;
+        }
+    }
+
+    if (renderer->getFeatures().preferAggregateBarrierCalls.enabled)
+    {
+        callCount = std::min(callCount, 1u);
+    }
+    return callCount;
+}
+
 void PipelineBarrierArray::addDiagnosticsString(std::ostringstream &out) const
 {
     out << "Memory Barrier: ";
@@ -6247,6 +6638,7 @@ void ImageHelper::resetCachedProperties()
     mCurrentDeviceQueueIndex     = kInvalidDeviceQueueIndex;
     mIsReleasedToExternal        = false;
     mIsForeignImage              = false;
+    mIsEGLImageSibling           = false;
     mLastNonShaderReadOnlyLayout = ImageLayout::Undefined;
     mCurrentShaderReadStageMask  = 0;
     mFirstAllocatedLevel         = gl::LevelIndex(0);
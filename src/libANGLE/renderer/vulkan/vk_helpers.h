@@ -665,6 +665,7 @@ constexpr uint32_t kDefaultTransformFeedbackQueryPoolSize   = 128;
 constexpr uint32_t kDefaultPrimitivesGeneratedQueryPoolSize = 128;
 
 class QueryHelper;
+class QueryResult;
 
 class DynamicQueryPool final : public DynamicallyGrowingPool<QueryPool>
 {
@@ -673,6 +674,8 @@ class DynamicQueryPool final : public DynamicallyGrowingPool<QueryPool>
     ~DynamicQueryPool() override;
 
     angle::Result init(ContextVk *contextVk, VkQueryType type, uint32_t poolSize);
+    void destroy(Renderer *renderer);
+    // Only for pools that don't copy their results to a buffer.
     void destroy(VkDevice device);
 
     angle::Result allocateQuery(ContextVk *contextVk, QueryHelper *queryOut, uint32_t queryCount);
@@ -680,6 +683,25 @@ class DynamicQueryPool final : public DynamicallyGrowingPool<QueryPool>
 
     const QueryPool &getQueryPool(size_t index) const { return getPool(index); }
 
+    // With copyOcclusionQueryResultsToBuffer, the results of render pass queries are copied to a
+    // host-visible buffer once the render pass is flushed, so they can be read back without
+    // calling vkGetQueryPoolResults on every poll.
+    bool copiesResultsToBuffer() const { return mCopyResultsToBuffer; }
+    void onRenderPassQueryEnded(size_t poolIndex, uint32_t query, uint32_t queryCount);
+    bool hasPendingResultCopies() const { return !mPendingResultCopies.empty(); }
+    // Records the copies of the queries that ended in the flushed render passes.  |queueSerial| is
+    // that of |commandBuffer|.
+    void flushPendingResultCopies(OutsideRenderPassCommandBuffer *commandBuffer,
+                                  const QueueSerial &queueSerial);
+    // Returns the serial of the commands that copy the query's results, or an invalid serial if
+    // they are not copied.
+    const QueueSerial &getResultCopySerial(size_t poolIndex, uint32_t query) const;
+    void getCopiedResults(Renderer *renderer,
+                          size_t poolIndex,
+                          uint32_t query,
+                          uint32_t queryCount,
+                          QueryResult *resultOut);
+
   private:
     angle::Result allocatePoolImpl(ContextVk *contextVk,
                                    QueryPool &poolToAllocate,
@@ -688,6 +710,21 @@ class DynamicQueryPool final : public DynamicallyGrowingPool<QueryPool>
 
     // Information required to create new query pools
     VkQueryType mQueryType;
+
+    struct PendingResultCopy
+    {
+        size_t poolIndex;
+        uint32_t query;
+        uint32_t queryCount;
+    };
+
+    bool mCopyResultsToBuffer;
+    // One buffer per query pool, with one result per query.
+    std::vector<BufferHelper> mResultBuffers;
+    // The serial of the copy of each query's results, indexed by poolIndex * poolSize + query.
+    std::vector<QueueSerial> mResultCopySerials;
+    // Contiguous queries of the same pool are merged in a single copy.
+    std::vector<PendingResultCopy> mPendingResultCopies;
 };
 
 // Stores the result of a Vulkan query call. XFB queries in particular store two result values.
@@ -737,7 +774,7 @@ class QueryHelper final : public Resource
     ~QueryHelper() override;
     QueryHelper(QueryHelper &&rhs);
     QueryHelper &operator=(QueryHelper &&rhs);
-    void init(const DynamicQueryPool *dynamicQueryPool,
+    void init(DynamicQueryPool *dynamicQueryPool,
               const size_t queryPoolIndex,
               uint32_t query,
               uint32_t queryCount);
@@ -790,8 +827,11 @@ class QueryHelper final : public Resource
     VkResult getResultImpl(ContextVk *contextVk,
                            const VkQueryResultFlags flags,
                            QueryResult *resultOut);
+    // Whether the results are read from the pool's result buffer instead of the query pool.
+    bool hasCopiedResults(ContextVk *contextVk) const;
+    const QueueSerial &getResultCopySerial() const;
 
-    const DynamicQueryPool *mDynamicQueryPool;
+    DynamicQueryPool *mDynamicQueryPool;
     size_t mQueryPoolIndex;
     uint32_t mQuery;
     uint32_t mQueryCount;
@@ -947,8 +987,10 @@ class PipelineBarrier : angle::NonCopyable
         mDstStageMask |= other->mDstStageMask;
         mMemoryBarrierSrcAccess |= other->mMemoryBarrierSrcAccess;
         mMemoryBarrierDstAccess |= other->mMemoryBarrierDstAccess;
-        mImageMemoryBarriers.insert(mImageMemoryBarriers.end(), other->mImageMemoryBarriers.begin(),
-                                    other->mImageMemoryBarriers.end());
+        for (const VkImageMemoryBarrier &imageMemoryBarrier : other->mImageMemoryBarriers)
+        {
+            addImageBarrier(imageMemoryBarrier);
+        }
         other->reset();
     }
 
@@ -970,7 +1012,7 @@ class PipelineBarrier : angle::NonCopyable
         ASSERT(imageMemoryBarrier.pNext == nullptr);
         mSrcStageMask |= srcStageMask;
         mDstStageMask |= dstStageMask;
-        mImageMemoryBarriers.push_back(imageMemoryBarrier);
+        addImageBarrier(imageMemoryBarrier);
     }
 
     void reset()
@@ -984,7 +1026,18 @@ class PipelineBarrier : angle::NonCopyable
 
     void addDiagnosticsString(std::ostringstream &out) const;
 
+    // For testing.
+    VkAccessFlags getMemoryBarrierDstAccess() const { return mMemoryBarrierDstAccess; }
+    const std::vector<VkImageMemoryBarrier> &getImageMemoryBarriers() const
+    {
+        return mImageMemoryBarriers;
+    }
+
   private:
+    // Adds the image barrier, unless it can be folded into the global memory barrier or into an
+    // image barrier of the same subresources that's already part of this barrier.
+    void addImageBarrier(const VkImageMemoryBarrier &imageMemoryBarrier);
+
     VkPipelineStageFlags mSrcStageMask;
     VkPipelineStageFlags mDstStageMask;
     VkAccessFlags mMemoryBarrierSrcAccess;
@@ -1003,6 +1056,7 @@ class PipelineBarrierArray final
     {
         mBarriers[stageIndex].mergeMemoryBarrier(srcStageMask, dstStageMask, srcAccess, dstAccess);
         mBarrierMask.set(stageIndex);
+        ++mRequestedBarrierCount;
     }
 
     void mergeImageBarrier(PipelineStage stageIndex,
@@ -1012,15 +1066,22 @@ class PipelineBarrierArray final
     {
         mBarriers[stageIndex].mergeImageBarrier(srcStageMask, dstStageMask, imageMemoryBarrier);
         mBarrierMask.set(stageIndex);
+        ++mRequestedBarrierCount;
     }
 
     void execute(Renderer *renderer, PrimaryCommandBuffer *primary);
 
+    // The number of barriers requested since the last execute(), and the number of
+    // vkCmdPipelineBarrier calls execute() batches them into.
+    uint32_t getRequestedBarrierCount() const { return mRequestedBarrierCount; }
+    uint32_t getPipelineBarrierCallCount(Renderer *renderer) const;
+
     void addDiagnosticsString(std::ostringstream &out) const;
 
   private:
     angle::PackedEnumMap<PipelineStage, PipelineBarrier> mBarriers;
     PipelineStagesMask mBarrierMask;
+    uint32_t mRequestedBarrierCount = 0;
 };
 
 enum class MemoryCoherency : uint8_t
@@ -1280,6 +1341,8 @@ class BufferPool : angle::NonCopyable
   private:
     VkResult allocateNewBuffer(ErrorContext *context, VkDeviceSize sizeInBytes);
     VkDeviceSize getTotalEmptyMemorySize() const;
+    // Orders mBufferBlocks from the least used to the most used block.
+    void sortBufferBlocksByUsage();
 
     vma::VirtualBlockCreateFlags mVirtualBlockCreateFlags;
     VkBufferUsageFlags mUsage;
@@ -1517,8 +1580,22 @@ class CommandBufferHelperCommon : angle::NonCopyable
         return hostBufferWrite;
     }
 
+    bool getAndResetUsesImageSharedAcrossShareGroups()
+    {
+        bool usesSharedImage              = mUsesImageSharedAcrossShareGroups;
+        mUsesImageSharedAcrossShareGroups = false;
+        return usesSharedImage;
+    }
+
     void executeBarriers(Renderer *renderer, CommandsState *commandsState);
 
+    void addBarrierPerfCounters(Renderer *renderer, angle::VulkanPerfCounters *perfCounters) const
+    {
+        perfCounters->pipelineBarriersRequested += mPipelineBarriers.getRequestedBarrierCount();
+        perfCounters->pipelineBarriersIssued +=
+            mPipelineBarriers.getPipelineBarrierCallCount(renderer);
+    }
+
     // The markOpen and markClosed functions are to aid in proper use of the *CommandBufferHelper.
     // saw invalid use due to threading issues that can be easily caught by marking when it's safe
     // (open) to write to the command buffer.
@@ -1567,6 +1644,8 @@ class CommandBufferHelperCommon : angle::NonCopyable
     CommandBufferHelperCommon();
     ~CommandBufferHelperCommon();
 
+    void onImageUse(const ImageHelper &image);
+
     void initializeImpl();
 
     void resetImpl(ErrorContext *context);
@@ -1650,6 +1729,9 @@ class CommandBufferHelperCommon : angle::NonCopyable
 
     // Check for any buffer write commands recorded for host-visible buffers
     bool mIsAnyHostVisibleBufferWritten = false;
+
+    // Check for any use of images that contexts of other share groups may also use
+    bool mUsesImageSharedAcrossShareGroups = false;
 };
 
 class SecondaryCommandBufferCollector;
@@ -1949,7 +2031,7 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     bool usesImage(const ImageHelper &image) const;
     bool startedAndUsesImageWithBarrier(const ImageHelper &image) const;
 
-    angle::Result flushToPrimary(Context *context,
+    angle::Result flushToPrimary(ErrorContext *context,
                                  CommandsState *commandsState,
                                  const RenderPass &renderPass,
                                  VkFramebuffer framebufferOverride);
@@ -2004,6 +2086,12 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     // larger scissor is specified, grow the render area to accommodate it.
     void growRenderArea(ContextVk *contextVk, const gl::Rectangle &newRenderArea);
 
+    // A scissored clear that starts the render pass can use loadOp=Clear, as the render area is
+    // the scissor.  If the render area grows before anything else is recorded, those clears are
+    // turned into vkCmdClearAttachments.  After that, the render area can no longer grow.
+    void onScissoredLoadOpClear() { mHasScissoredLoadOpClears = true; }
+    bool canGrowRenderArea(const gl::Rectangle &newRenderArea);
+
     void resumeTransformFeedback();
     void pauseTransformFeedback();
     bool isTransformFeedbackStarted() const { return mValidTransformFeedbackBufferCount > 0; }
@@ -2072,6 +2160,7 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     {
         return mImageOptimizeForPresent == image;
     }
+    bool hasImageOptimizedForPresent() const { return mImageOptimizeForPresent != nullptr; }
 
     void setGLMemoryBarrierIssued()
     {
@@ -2132,6 +2221,8 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     void finalizeDepthStencilImageLayoutAndLoadStore(Context *context);
     void finalizeFragmentShadingRateImageLayout(Context *context);
 
+    void convertScissoredLoadOpClearsToClearAttachments(ContextVk *contextVk);
+
     // When using Vulkan secondary command buffers, each subpass must be recorded in a separate
     // command buffer.  Currently ANGLE produces render passes with at most 2 subpasses.
     static constexpr size_t kMaxSubpassCount = 2;
@@ -2146,6 +2237,7 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     gl::Rectangle mRenderArea;
     PackedClearValuesArray mClearValues;
     bool mRenderPassStarted;
+    bool mHasScissoredLoadOpClears;
 
     // Transform feedback state
     gl::TransformFeedbackBuffersArray<VkBuffer> mTransformFeedbackCounterBuffers;
@@ -2832,6 +2924,14 @@ class ImageHelper final : public Resource, public angle::Subject
     bool isReleasedToExternal() const { return mIsReleasedToExternal; }
     // Returns true if the image was sourced from the FOREIGN queue.
     bool isForeignImage() const { return mIsForeignImage; }
+    // Marks the image as the storage of an EGLImage.
+    void setIsEGLImageSibling() { mIsEGLImageSibling = true; }
+    // Returns true if contexts of other share groups, or other APIs, may use the image.  Their
+    // commands may be submitted before the commands of this context that use the image.
+    bool isSharedAcrossShareGroups() const
+    {
+        return mIsEGLImageSibling || mIsForeignImage || isBackedByExternalMemory();
+    }
     // Returns true if the image is owned by a foreign entity.
     bool isReleasedToForeign() const
     {
@@ -3442,6 +3542,8 @@ class ImageHelper final : public Resource, public angle::Subject
     bool mIsReleasedToExternal;
     // Whether this image came from a foreign source.
     bool mIsForeignImage;
+    // Whether this image is the storage of an EGLImage.
+    bool mIsEGLImageSibling;
 
     // For imported images
     YcbcrConversionDesc mYcbcrConversionDesc;
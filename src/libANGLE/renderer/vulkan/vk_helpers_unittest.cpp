@@ -0,0 +1,235 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_helpers_unittest:
+//   Unit tests for the Vulkan helpers.
+//
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include "libANGLE/renderer/vulkan/vk_helpers.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+constexpr uint32_t kQueueFamily        = 0;
+constexpr uint32_t kForeignQueueFamily = 1;
+
+VkImage MakeImage(uint64_t handle)
+{
+    // Non-dispatchable handles are 64-bit on all platforms.
+    static_assert(sizeof(VkImage) == sizeof(handle), "Unexpected handle size");
+    VkImage image;
+    memcpy(&image, &handle, sizeof(image));
+    return image;
+}
+
+VkImageMemoryBarrier MakeImageBarrier(VkImage image,
+                                      VkImageLayout oldLayout,
+                                      VkImageLayout newLayout,
+                                      VkAccessFlags srcAccessMask,
+                                      VkAccessFlags dstAccessMask)
+{
+    VkImageMemoryBarrier barrier            = {};
+    barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask                   = srcAccessMask;
+    barrier.dstAccessMask                   = dstAccessMask;
+    barrier.oldLayout                       = oldLayout;
+    barrier.newLayout                       = newLayout;
+    barrier.srcQueueFamilyIndex             = kQueueFamily;
+    barrier.dstQueueFamilyIndex             = kQueueFamily;
+    barrier.image                           = image;
+    barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel   = 0;
+    barrier.subresourceRange.levelCount     = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount     = 1;
+    return barrier;
+}
+
+void MergeImageBarrier(PipelineBarrier *pipelineBarrier, const VkImageMemoryBarrier &barrier)
+{
+    pipelineBarrier->mergeImageBarrier(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                       VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, barrier);
+}
+
+// A barrier that only makes previous accesses visible to a new stage is folded into the global
+// memory barrier.
+TEST(PipelineBarrierTest, ReadOnlyBarrierFoldedIntoMemoryBarrier)
+{
+    PipelineBarrier pipelineBarrier;
+    MergeImageBarrier(&pipelineBarrier,
+                      MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0,
+                                       VK_ACCESS_SHADER_READ_BIT));
+
+    EXPECT_TRUE(pipelineBarrier.getImageMemoryBarriers().empty());
+    EXPECT_EQ(static_cast<VkAccessFlags>(VK_ACCESS_SHADER_READ_BIT),
+              pipelineBarrier.getMemoryBarrierDstAccess());
+    pipelineBarrier.reset();
+}
+
+// A duplicate barrier of the same subresources only has its access masks combined.
+TEST(PipelineBarrierTest, DuplicateBarrierMerged)
+{
+    PipelineBarrier pipelineBarrier;
+    MergeImageBarrier(&pipelineBarrier,
+                      MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                       VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                                       VK_ACCESS_SHADER_READ_BIT));
+    MergeImageBarrier(&pipelineBarrier,
+                      MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                       VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                                       VK_ACCESS_INPUT_ATTACHMENT_READ_BIT));
+
+    const std::vector<VkImageMemoryBarrier> &barriers = pipelineBarrier.getImageMemoryBarriers();
+    ASSERT_EQ(1u, barriers.size());
+    EXPECT_EQ(static_cast<VkAccessFlags>(VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT),
+              barriers[0].srcAccessMask);
+    EXPECT_EQ(static_cast<VkAccessFlags>(VK_ACCESS_SHADER_READ_BIT |
+                                         VK_ACCESS_INPUT_ATTACHMENT_READ_BIT),
+              barriers[0].dstAccessMask);
+    pipelineBarrier.reset();
+}
+
+// A transition that continues a previous one (A->B, then B->C) is collapsed into A->C.
+TEST(PipelineBarrierTest, ChainedTransitionsCollapsed)
+{
+    PipelineBarrier pipelineBarrier;
+    MergeImageBarrier(&pipelineBarrier,
+                      MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_UNDEFINED,
+                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0,
+                                       VK_ACCESS_TRANSFER_WRITE_BIT));
+    MergeImageBarrier(&pipelineBarrier,
+                      MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0,
+                                       VK_ACCESS_SHADER_READ_BIT));
+
+    const std::vector<VkImageMemoryBarrier> &barriers = pipelineBarrier.getImageMemoryBarriers();
+    ASSERT_EQ(1u, barriers.size());
+    EXPECT_EQ(VK_IMAGE_LAYOUT_UNDEFINED, barriers[0].oldLayout);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, barriers[0].newLayout);
+    EXPECT_EQ(static_cast<VkAccessFlags>(VK_ACCESS_SHADER_READ_BIT), barriers[0].dstAccessMask);
+    pipelineBarrier.reset();
+}
+
+// Barriers of different images or subresources are not merged.
+TEST(PipelineBarrierTest, DifferentSubresourcesNotMerged)
+{
+    PipelineBarrier pipelineBarrier;
+    VkImageMemoryBarrier barrier =
+        MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                         VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+    MergeImageBarrier(&pipelineBarrier, barrier);
+
+    VkImageMemoryBarrier otherLevel         = barrier;
+    otherLevel.subresourceRange.baseMipLevel = 1;
+    MergeImageBarrier(&pipelineBarrier, otherLevel);
+
+    VkImageMemoryBarrier otherImage = barrier;
+    otherImage.image                = MakeImage(2);
+    MergeImageBarrier(&pipelineBarrier, otherImage);
+
+    EXPECT_EQ(3u, pipelineBarrier.getImageMemoryBarriers().size());
+    pipelineBarrier.reset();
+}
+
+// A queue family ownership release is never merged into an existing barrier of the same image, so
+// its destination queue family is kept.
+TEST(PipelineBarrierTest, OwnershipReleaseNotMerged)
+{
+    PipelineBarrier pipelineBarrier;
+    VkImageMemoryBarrier barrier =
+        MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                         VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                         VK_ACCESS_SHADER_READ_BIT);
+    MergeImageBarrier(&pipelineBarrier, barrier);
+
+    VkImageMemoryBarrier release = barrier;
+    release.dstQueueFamilyIndex  = kForeignQueueFamily;
+    MergeImageBarrier(&pipelineBarrier, release);
+
+    const std::vector<VkImageMemoryBarrier> &barriers = pipelineBarrier.getImageMemoryBarriers();
+    ASSERT_EQ(2u, barriers.size());
+    EXPECT_EQ(kQueueFamily, barriers[0].dstQueueFamilyIndex);
+    EXPECT_EQ(kQueueFamily, barriers[1].srcQueueFamilyIndex);
+    EXPECT_EQ(kForeignQueueFamily, barriers[1].dstQueueFamilyIndex);
+    pipelineBarrier.reset();
+}
+
+// No barrier is merged into a queue family ownership acquire.
+TEST(PipelineBarrierTest, NothingMergedIntoOwnershipAcquire)
+{
+    PipelineBarrier pipelineBarrier;
+    VkImageMemoryBarrier acquire =
+        MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_GENERAL,
+                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, VK_ACCESS_SHADER_READ_BIT);
+    acquire.srcQueueFamilyIndex = kForeignQueueFamily;
+    MergeImageBarrier(&pipelineBarrier, acquire);
+
+    // Continues the acquired image's transition on the local queue family.
+    MergeImageBarrier(&pipelineBarrier,
+                      MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                       VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, 0,
+                                       VK_ACCESS_TRANSFER_READ_BIT));
+
+    const std::vector<VkImageMemoryBarrier> &barriers = pipelineBarrier.getImageMemoryBarriers();
+    ASSERT_EQ(2u, barriers.size());
+    EXPECT_EQ(kForeignQueueFamily, barriers[0].srcQueueFamilyIndex);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, barriers[0].newLayout);
+    pipelineBarrier.reset();
+}
+
+// Two identical ownership releases are both kept.
+TEST(PipelineBarrierTest, OwnershipReleasesNotMergedTogether)
+{
+    PipelineBarrier pipelineBarrier;
+    VkImageMemoryBarrier release =
+        MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL,
+                         VK_ACCESS_SHADER_WRITE_BIT, 0);
+    release.dstQueueFamilyIndex = kForeignQueueFamily;
+    MergeImageBarrier(&pipelineBarrier, release);
+    MergeImageBarrier(&pipelineBarrier, release);
+
+    EXPECT_EQ(2u, pipelineBarrier.getImageMemoryBarriers().size());
+    pipelineBarrier.reset();
+}
+
+// Merging pipeline barriers applies the same rules to their image barriers.
+TEST(PipelineBarrierTest, MergedPipelineBarriersCoalesced)
+{
+    VkImageMemoryBarrier barrier =
+        MakeImageBarrier(MakeImage(1), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                         VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+    VkImageMemoryBarrier release = barrier;
+    release.dstQueueFamilyIndex  = kForeignQueueFamily;
+
+    PipelineBarrier pipelineBarrier;
+    MergeImageBarrier(&pipelineBarrier, barrier);
+
+    PipelineBarrier other;
+    MergeImageBarrier(&other, barrier);
+    MergeImageBarrier(&other, release);
+    pipelineBarrier.merge(&other);
+
+    const std::vector<VkImageMemoryBarrier> &barriers = pipelineBarrier.getImageMemoryBarriers();
+    ASSERT_EQ(2u, barriers.size());
+    EXPECT_EQ(kQueueFamily, barriers[0].dstQueueFamilyIndex);
+    EXPECT_EQ(kForeignQueueFamily, barriers[1].dstQueueFamilyIndex);
+    EXPECT_TRUE(other.isEmpty());
+    pipelineBarrier.reset();
+}
+}  // anonymous namespace
+}  // namespace vk
+}  // namespace rx
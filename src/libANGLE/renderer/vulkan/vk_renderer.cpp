@@ -1909,6 +1909,8 @@ Renderer::Renderer()
       mIsColorFramebufferFetchCoherent(false),
       mIsColorFramebufferFetchUsed(false),
       mCleanUpThread(this, &mCommandQueue),
+      mRenderPassReplayThread(this, &mCommandQueue),
+      mQueueSubmitThread(this, &mCommandQueue),
       mSupportedBufferWritePipelineStageMask(0),
       mSupportedVulkanShaderStageMask(0),
       mMemoryAllocationTracker(MemoryAllocationTracker(this)),
@@ -1957,11 +1959,20 @@ void Renderer::onDestroy(vk::ErrorContext *context)
         mPlaceHolderDescriptorSetLayout.reset();
     }
 
+    if (mFeatures.asyncRenderPassReplay.enabled)
+    {
+        mRenderPassReplayThread.destroy(context);
+    }
+    if (mFeatures.asyncQueueSubmit.enabled)
+    {
+        mQueueSubmitThread.destroy(context);
+    }
     mCleanUpThread.destroy(context);
     mCommandQueue.destroy(context);
 
     // mCommandQueue.destroy should already set "last completed" serials to infinite.
     cleanupGarbage(nullptr);
+    ASSERT(mPerContextGarbageLists.empty());
     ASSERT(!hasSharedGarbage());
     ASSERT(mOrphanedBufferBlockList.empty());
 
@@ -2894,6 +2905,11 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceFeatures, &mVertexInputDynamicStateFeatures);
     }
 
+    if (ExtensionFound(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceProperties, &mPushDescriptorProperties);
+    }
+
 #if defined(ANGLE_PLATFORM_ANDROID)
     if (ExtensionFound(VK_ANDROID_EXTERNAL_FORMAT_RESOLVE_EXTENSION_NAME, deviceExtensionNames))
     {
@@ -3289,6 +3305,10 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mHostImageCopyProperties.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
 
+    mPushDescriptorProperties = {};
+    mPushDescriptorProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+
     m8BitStorageFeatures       = {};
     m8BitStorageFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES_KHR;
 
@@ -3405,6 +3425,7 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mTimelineSemaphoreFeatures.pNext                  = nullptr;
     mHostImageCopyFeatures.pNext                      = nullptr;
     mHostImageCopyProperties.pNext                    = nullptr;
+    mPushDescriptorProperties.pNext                   = nullptr;
     m8BitStorageFeatures.pNext                        = nullptr;
     m16BitStorageFeatures.pNext                       = nullptr;
     mSynchronization2Features.pNext                   = nullptr;
@@ -3472,6 +3493,11 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         mEnabledDeviceExtensions.push_back(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME);
     }
 
+    if (mFeatures.supportsPushDescriptor.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    }
+
 #if defined(ANGLE_PLATFORM_ANDROID)
     if (mFeatures.supportsAndroidHardwareBuffer.enabled)
     {
@@ -4094,12 +4120,20 @@ void Renderer::initDeviceExtensionEntryPoints()
     {
         InitDeviceFaultFunctions(mDevice);
     }
+    if (mFeatures.supportsPushDescriptor.enabled)
+    {
+        InitPushDescriptorFunctions(mDevice);
+    }
     // Extensions promoted to Vulkan 1.2
     {
         if (mFeatures.supportsHostQueryReset.enabled)
         {
             InitHostQueryResetFunctions(mDevice);
         }
+        if (mFeatures.supportsTimelineSemaphore.enabled)
+        {
+            InitTimelineSemaphoreFunctions(mDevice);
+        }
         if (mFeatures.supportsRenderpass2.enabled)
         {
             InitRenderPass2KHRFunctions(mDevice);
@@ -4305,6 +4339,14 @@ angle::Result Renderer::createDeviceAndQueue(vk::ErrorContext *context, uint32_t
 
     ANGLE_TRY(mCommandQueue.init(context, queueFamily, enableProtectedContent, queueCount));
     ANGLE_TRY(mCleanUpThread.init());
+    if (mFeatures.asyncRenderPassReplay.enabled)
+    {
+        ANGLE_TRY(mRenderPassReplayThread.init());
+    }
+    if (mFeatures.asyncQueueSubmit.enabled)
+    {
+        ANGLE_TRY(mQueueSubmitThread.init());
+    }
 
     if (mFeatures.forceMaxUniformBufferSize16KB.enabled)
     {
@@ -5336,6 +5378,15 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, asyncCommandBufferReset,
                             mFeatures.asyncGarbageCleanup.enabled && !isARM);
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncRenderPassReplay, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncQueueSubmit, false);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, mergeRenderPassesAcrossFramebuffers, false);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, clearScissoredAttachmentsWithLoadOp, false);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, copyOcclusionQueryResultsToBuffer, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsYUVSamplerConversion,
                             mSamplerYcbcrConversionFeatures.samplerYcbcrConversion != VK_FALSE);
 
@@ -5458,6 +5509,7 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(
         &mFeatures, supportsMemoryBudget,
         ExtensionFound(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, deviceExtensionNames));
+    ANGLE_FEATURE_CONDITION(&mFeatures, budgetAwareAllocation, false);
 
     // Disabled by default. Only enable it for experimental purpose, as this will cause various
     // tests to fail.
@@ -5656,6 +5708,16 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         &mFeatures, preferDeviceLocalMemoryHostVisible,
         canPreferDeviceLocalMemoryHostVisible(mPhysicalDeviceProperties.deviceType));
 
+    // Speculatively copying device local buffers that are read back by the application trades
+    // extra copies and host cached memory for fewer stalls at map time.  Not enabled by default
+    // until it has seen wider testing.
+    ANGLE_FEATURE_CONDITION(&mFeatures, speculativeReadbackForDeviceLocalBuffers, false);
+
+    // Applications that switch between contexts of a share group many times per frame would
+    // otherwise incur a submission per switch.  Not enabled by default until it has seen wider
+    // testing.
+    ANGLE_FEATURE_CONDITION(&mFeatures, deferSubmissionOnShareGroupContextSwitch, false);
+
     // Multiple dynamic state issues on ARM have been fixed.
     // http://issuetracker.google.com/285124778
     // http://issuetracker.google.com/285196249
@@ -5965,6 +6027,17 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 mHostImageCopyProperties.identicalMemoryTypeRequirements &&
                                 !IsFuchsia());
 
+    // VK_KHR_push_descriptor lets the texture descriptors be recorded in the command buffer, so
+    // texture rebinds don't allocate or update descriptor sets.  The spec guarantees
+    // maxPushDescriptors >= 32.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsPushDescriptor,
+        ExtensionFound(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, deviceExtensionNames) &&
+            mPushDescriptorProperties.maxPushDescriptors > 0);
+
+    // Off until the push descriptor path has run on the bots; enabled in tests.
+    ANGLE_FEATURE_CONDITION(&mFeatures, pushTextureDescriptors, false);
+
     // 1) host vk driver does not natively support ETC format.
     // 2) host vk driver supports BC format.
     // 3) host vk driver supports subgroup instructions: clustered, shuffle.
@@ -6043,6 +6116,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
                             mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
 
+    // Tracking submissions with timeline semaphores avoids creating, resetting and recycling a
+    // fence per submission.  Not enabled by default until it has seen wider testing.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useTimelineSemaphoreForSubmissions, false);
+
     // 8bit storage features
     ANGLE_FEATURE_CONDITION(&mFeatures, supports8BitStorageBuffer,
                             m8BitStorageFeatures.storageBuffer8BitAccess == VK_TRUE);
@@ -6401,6 +6478,11 @@ void Renderer::initializeFrontendFeatures(angle::FrontendFeatures *features) con
     // Always run the link's warm up job in a thread.  It's an optimization only, and does not block
     // the link resolution.
     ANGLE_FEATURE_CONDITION(features, alwaysRunLinkSubJobsThreaded, true);
+
+    // Swapping the current surface only touches the context, the surface and the thread-safe
+    // parts of the renderer, so it doesn't need the global EGL lock.  Off until it has run on the
+    // bots; enabled in tests.
+    ANGLE_FEATURE_CONDITION(features, swapBuffersWithoutGlobalLock, false);
 }
 
 angle::Result Renderer::getLockedPipelineCacheDataIfNew(vk::ErrorContext *context,
@@ -6689,10 +6771,43 @@ bool Renderer::haveSameFormatFeatureBits(angle::FormatID formatID1, angle::Forma
            hasImageFormatFeatureBits(formatID2, fmt1OptimalFeatureBits);
 }
 
+void Renderer::registerPerContextGarbageList(vk::PerContextGarbageList *garbageList)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mPerContextGarbageListsMutex);
+    mPerContextGarbageLists.push_back(garbageList);
+}
+
+void Renderer::unregisterPerContextGarbageList(vk::PerContextGarbageList *garbageList)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mPerContextGarbageListsMutex);
+    mergePerContextGarbageList(garbageList);
+
+    auto iter =
+        std::find(mPerContextGarbageLists.begin(), mPerContextGarbageLists.end(), garbageList);
+    ASSERT(iter != mPerContextGarbageLists.end());
+    mPerContextGarbageLists.erase(iter);
+}
+
+void Renderer::mergePerContextGarbageList(vk::PerContextGarbageList *garbageList)
+{
+    garbageList->takeAll([this](vk::SharedGarbage &&garbage) {
+        mSharedGarbageList.add(this, std::move(garbage));
+    });
+}
+
 void Renderer::cleanupGarbage(bool *anyGarbageCleanedOut)
 {
     bool anyCleaned = false;
 
+    // Move garbage retired by the contexts to the shared garbage list first.
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mPerContextGarbageListsMutex);
+        for (vk::PerContextGarbageList *garbageList : mPerContextGarbageLists)
+        {
+            mergePerContextGarbageList(garbageList);
+        }
+    }
+
     // Clean up general garbage
     anyCleaned = (mSharedGarbageList.cleanupSubmittedGarbage(this) > 0) || anyCleaned;
 
@@ -6854,10 +6969,27 @@ angle::Result Renderer::submitCommands(
         externalFenceCopy = *externalFence;
     }
 
+    // Render passes handed over to the replay thread must be in the primary command buffer first.
+    if (mFeatures.asyncRenderPassReplay.enabled)
+    {
+        ANGLE_TRY(mRenderPassReplayThread.waitIdle(context));
+    }
+
+    // Report errors from submissions the submit thread made since the last flush.
+    if (mFeatures.asyncQueueSubmit.enabled)
+    {
+        ANGLE_TRY(mQueueSubmitThread.checkAndPopPendingError(context));
+    }
+
     ANGLE_TRY(mCommandQueue.submitCommands(
         context, protectionType, contextPriority, signalVkSemaphore, std::move(externalFenceCopy),
         std::move(imagesToTransitionToForeign), submitQueueSerial));
 
+    if (mFeatures.asyncQueueSubmit.enabled && mCommandQueue.hasPendingSubmissions())
+    {
+        mQueueSubmitThread.requestSubmit();
+    }
+
     ANGLE_TRY(mCommandQueue.postSubmitCheck(context));
 
     return angle::Result::Continue;
@@ -6952,6 +7084,34 @@ angle::Result Renderer::flushRenderPassCommands(
     vk::RenderPassCommandBufferHelper **renderPassCommands)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "Renderer::flushRenderPassCommands");
+
+    // With async render pass replay, hand the helper over to the replay thread and give the
+    // context a fresh one to record the next render pass in.  This relies on ANGLE's secondary
+    // command buffers, which are self-contained.  The present layout transition done at the end of
+    // the render pass modifies the image's state, so that case is replayed inline.
+    if (vk::RenderPassCommandBufferHelper::ExecutesInline() &&
+        mFeatures.asyncRenderPassReplay.enabled &&
+        !(*renderPassCommands)->hasImageOptimizedForPresent())
+    {
+        vk::RenderPassReplayTask task;
+        task.protectionType      = protectionType;
+        task.priority            = priority;
+        task.renderPass          = renderPass.getHandle();
+        task.framebufferOverride = framebufferOverride;
+        task.renderPassCommands  = *renderPassCommands;
+
+        // ANGLE's secondary command buffers don't allocate from a command pool.
+        ANGLE_TRY(getRenderPassCommandBufferHelper(context, nullptr, renderPassCommands));
+
+        mRenderPassReplayThread.enqueue(task);
+        return angle::Result::Continue;
+    }
+
+    if (mFeatures.asyncRenderPassReplay.enabled)
+    {
+        ANGLE_TRY(mRenderPassReplayThread.waitIdle(context));
+    }
+
     return mCommandQueue.flushRenderPassCommands(context, protectionType, priority, renderPass,
                                                  framebufferOverride, renderPassCommands);
 }
@@ -6963,6 +7123,13 @@ angle::Result Renderer::flushOutsideRPCommands(
     vk::OutsideRenderPassCommandBufferHelper **outsideRPCommands)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "Renderer::flushOutsideRPCommands");
+
+    // Keep the outside render pass commands ordered after render passes that are being replayed.
+    if (mFeatures.asyncRenderPassReplay.enabled)
+    {
+        ANGLE_TRY(mRenderPassReplayThread.waitIdle(context));
+    }
+
     return mCommandQueue.flushOutsideRPCommands(context, protectionType, priority,
                                                 outsideRPCommands);
 }
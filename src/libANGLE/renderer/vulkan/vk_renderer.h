@@ -194,6 +194,11 @@ class Renderer : angle::NonCopyable
     {
         return mHostImageCopyProperties;
     }
+    const VkPhysicalDevicePushDescriptorPropertiesKHR &getPhysicalDevicePushDescriptorProperties()
+        const
+    {
+        return mPushDescriptorProperties;
+    }
     const VkPhysicalDeviceFeatures &getPhysicalDeviceFeatures() const
     {
         return mPhysicalDeviceFeatures;
@@ -356,6 +361,30 @@ class Renderer : angle::NonCopyable
         }
     }
 
+    // Same as above, but the garbage is added to the context's lock-free list, to be merged into
+    // the shared garbage list by cleanupGarbage().
+    void collectGarbage(const vk::ResourceUse &use,
+                        vk::GarbageObjects &&sharedGarbage,
+                        vk::PerContextGarbageList *perContextGarbageList)
+    {
+        ASSERT(!sharedGarbage.empty());
+        if (hasResourceUseFinished(use))
+        {
+            for (auto &garbage : sharedGarbage)
+            {
+                garbage.destroy(this);
+            }
+            sharedGarbage.clear();
+        }
+        else
+        {
+            perContextGarbageList->add(vk::SharedGarbage(use, std::move(sharedGarbage)));
+        }
+    }
+
+    void registerPerContextGarbageList(vk::PerContextGarbageList *garbageList);
+    void unregisterPerContextGarbageList(vk::PerContextGarbageList *garbageList);
+
     void collectSuballocationGarbage(const vk::ResourceUse &use,
                                      vk::BufferSuballocation &&suballocation,
                                      vk::Buffer &&buffer)
@@ -647,6 +676,20 @@ class Renderer : angle::NonCopyable
 
     MemoryAllocationTracker *getMemoryAllocationTracker() { return &mMemoryAllocationTracker; }
 
+    // Whether allocating |size| more bytes from the heap of the given memory type would bring the
+    // heap close to its budget. Always false unless budgetAwareAllocation is enabled.
+    bool isMemoryTypeNearBudget(uint32_t memoryTypeIndex, VkDeviceSize size) const
+    {
+        return mFeatures.budgetAwareAllocation.enabled &&
+               mMemoryAllocationTracker.isHeapNearMemoryBudget(
+                   mMemoryProperties.getHeapIndexForMemoryType(memoryTypeIndex), size);
+    }
+    bool isAnyHeapNearBudget() const
+    {
+        return mFeatures.budgetAwareAllocation.enabled &&
+               mMemoryAllocationTracker.isAnyHeapNearMemoryBudget();
+    }
+
     VkDeviceSize getPendingGarbageSizeLimit() const { return mPendingGarbageSizeLimit; }
 
     void requestAsyncCommandsAndGarbageCleanup(vk::ErrorContext *context);
@@ -708,6 +751,8 @@ class Renderer : angle::NonCopyable
     void ensureCapsInitialized() const;
     void initializeValidationMessageSuppressions();
 
+    void mergePerContextGarbageList(vk::PerContextGarbageList *garbageList);
+
     void queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceExtensionNames);
     void appendDeviceExtensionFeaturesNotPromoted(const vk::ExtensionNameList &deviceExtensionNames,
                                                   VkPhysicalDeviceFeatures2KHR *deviceFeatures,
@@ -878,6 +923,7 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceTimelineSemaphoreFeaturesKHR mTimelineSemaphoreFeatures;
     VkPhysicalDeviceHostImageCopyFeaturesEXT mHostImageCopyFeatures;
     VkPhysicalDeviceHostImageCopyPropertiesEXT mHostImageCopyProperties;
+    VkPhysicalDevicePushDescriptorPropertiesKHR mPushDescriptorProperties;
     VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT mTextureCompressionASTCHDRFeatures;
     std::vector<VkImageLayout> mHostImageCopySrcLayoutsStorage;
     std::vector<VkImageLayout> mHostImageCopyDstLayoutsStorage;
@@ -915,6 +961,11 @@ class Renderer : angle::NonCopyable
     bool mDeviceLost;
 
     vk::SharedGarbageList<vk::SharedGarbage> mSharedGarbageList;
+    // Lock-free garbage lists of every context, merged into mSharedGarbageList on clean up.  The
+    // mutex only protects the registration of the lists, which contexts take on creation and
+    // destruction.
+    angle::SimpleMutex mPerContextGarbageListsMutex;
+    std::vector<vk::PerContextGarbageList *> mPerContextGarbageLists;
     // Suballocations have its own dedicated garbage list for performance optimization since they
     // tend to be the most common garbage objects.
     vk::SharedGarbageList<vk::BufferSuballocationGarbage> mSuballocationGarbageList;
@@ -1004,6 +1055,8 @@ class Renderer : angle::NonCopyable
 
     // Async cleanup thread
     vk::CleanUpThread mCleanUpThread;
+    vk::RenderPassReplayThread mRenderPassReplayThread;
+    vk::QueueSubmitThread mQueueSubmitThread;
 
     // Command buffer pool management.
     vk::CommandBufferRecycler<vk::OutsideRenderPassCommandBufferHelper>
@@ -317,6 +317,117 @@ class SharedGarbageList final : angle::NonCopyable
     std::atomic<VkDeviceSize> mTotalGarbageDestroyed;
 };
 
+// LockFreeGarbageList holds the garbage a single context retires at submission time.  Adding to
+// the list is lock-free, so contexts never contend with each other (or with the clean up thread)
+// when retiring resources.  The renderer periodically takes the contents of every registered list
+// and merges them into its SharedGarbageList.
+//
+// add() is only called by the owning context, and takeAll() calls are serialized by the renderer,
+// but the two may run concurrently.  The list nodes are recycled: takeAll() returns them to a free
+// list that add() takes from, so retiring garbage doesn't allocate once the list is warmed up.
+template <class T>
+class LockFreeGarbageList final : angle::NonCopyable
+{
+  public:
+    LockFreeGarbageList() : mHead(nullptr), mFreeNodes(nullptr), mOwnerFreeNodes(nullptr) {}
+    ~LockFreeGarbageList()
+    {
+        ASSERT(empty());
+        DeleteNodes(mFreeNodes.exchange(nullptr, std::memory_order_acquire));
+        DeleteNodes(mOwnerFreeNodes);
+    }
+
+    void add(T &&garbage)
+    {
+        Node *node    = allocateNode();
+        node->garbage = std::move(garbage);
+        node->next    = mHead.load(std::memory_order_relaxed);
+        while (!mHead.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                            std::memory_order_relaxed))
+        {
+        }
+    }
+
+    bool empty() const { return mHead.load(std::memory_order_acquire) == nullptr; }
+
+    // Takes all the garbage out of the list, and passes them to |merge| in the order they were
+    // added.
+    template <typename MergeFunc>
+    void takeAll(MergeFunc &&merge)
+    {
+        Node *node = mHead.exchange(nullptr, std::memory_order_acquire);
+        if (node == nullptr)
+        {
+            return;
+        }
+
+        // The list is built in reverse; restore the submission order first.
+        Node *ordered = nullptr;
+        Node *last    = node;
+        while (node != nullptr)
+        {
+            Node *next = node->next;
+            node->next = ordered;
+            ordered    = node;
+            node       = next;
+        }
+
+        for (node = ordered; node != nullptr; node = node->next)
+        {
+            merge(std::move(node->garbage));
+        }
+
+        // Give the nodes back to the owner.
+        last->next = mFreeNodes.load(std::memory_order_relaxed);
+        while (!mFreeNodes.compare_exchange_weak(last->next, ordered, std::memory_order_release,
+                                                 std::memory_order_relaxed))
+        {
+        }
+    }
+
+  private:
+    struct Node
+    {
+        T garbage;
+        Node *next;
+    };
+
+    Node *allocateNode()
+    {
+        if (mOwnerFreeNodes == nullptr)
+        {
+            // Take all the nodes recycled by takeAll() at once.  Only whole lists are exchanged,
+            // so there is no ABA hazard.
+            mOwnerFreeNodes = mFreeNodes.exchange(nullptr, std::memory_order_acquire);
+            if (mOwnerFreeNodes == nullptr)
+            {
+                return new Node{T(), nullptr};
+            }
+        }
+
+        Node *node      = mOwnerFreeNodes;
+        mOwnerFreeNodes = node->next;
+        return node;
+    }
+
+    static void DeleteNodes(Node *node)
+    {
+        while (node != nullptr)
+        {
+            Node *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    // Garbage added and not yet taken, most recent first.
+    std::atomic<Node *> mHead;
+    // Nodes returned by takeAll(), and the ones the owner already took from there.
+    std::atomic<Node *> mFreeNodes;
+    Node *mOwnerFreeNodes;
+};
+using PerContextGarbageList = LockFreeGarbageList<SharedGarbage>;
+
 // This is a helper class for back-end objects used in Vk command buffers. They keep a record
 // of their use in ANGLE and VkQueues via ResourceUse.
 class Resource : angle::NonCopyable
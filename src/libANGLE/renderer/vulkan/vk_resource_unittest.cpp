@@ -0,0 +1,130 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_resource_unittest:
+//   Unit tests for the Vulkan resource helpers.
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "libANGLE/renderer/vulkan/vk_resource.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+// Move-only, like the garbage the list holds in the renderer.
+struct TestGarbage final : angle::NonCopyable
+{
+    TestGarbage() : value(0) {}
+    explicit TestGarbage(uint32_t valueIn) : value(valueIn) {}
+    TestGarbage(TestGarbage &&other) : value(other.value) { other.value = 0; }
+    TestGarbage &operator=(TestGarbage &&other)
+    {
+        std::swap(value, other.value);
+        return *this;
+    }
+
+    uint32_t value;
+};
+
+using TestGarbageList = LockFreeGarbageList<TestGarbage>;
+
+std::vector<uint32_t> TakeAll(TestGarbageList *list)
+{
+    std::vector<uint32_t> values;
+    list->takeAll([&values](TestGarbage &&garbage) { values.push_back(garbage.value); });
+    return values;
+}
+
+// Taking from an empty list does nothing.
+TEST(LockFreeGarbageListTest, Empty)
+{
+    TestGarbageList list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_TRUE(TakeAll(&list).empty());
+    EXPECT_TRUE(list.empty());
+}
+
+// Garbage is taken in the order it was added.
+TEST(LockFreeGarbageListTest, TakeAllInOrder)
+{
+    TestGarbageList list;
+    for (uint32_t value = 1; value <= 5; ++value)
+    {
+        list.add(TestGarbage(value));
+    }
+    EXPECT_FALSE(list.empty());
+
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4, 5}), TakeAll(&list));
+    EXPECT_TRUE(list.empty());
+}
+
+// The nodes given back by takeAll() are reused by the following adds, in more or fewer numbers
+// than were given back.
+TEST(LockFreeGarbageListTest, NodesRecycled)
+{
+    TestGarbageList list;
+    uint32_t nextValue = 1;
+    for (uint32_t round = 0; round < 10; ++round)
+    {
+        const uint32_t count = 1 + (round * 7) % 5;
+        std::vector<uint32_t> expected;
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            expected.push_back(nextValue);
+            list.add(TestGarbage(nextValue++));
+        }
+
+        EXPECT_EQ(expected, TakeAll(&list));
+        EXPECT_TRUE(list.empty());
+    }
+}
+
+// The owner adds garbage while another thread keeps taking it.  Every value must be taken exactly
+// once, in order.
+TEST(LockFreeGarbageListTest, ConcurrentAddAndTakeAll)
+{
+    constexpr uint32_t kValueCount = 200000;
+
+    TestGarbageList list;
+    std::atomic<bool> addFinished(false);
+
+    std::thread addThread([&]() {
+        for (uint32_t value = 1; value <= kValueCount; ++value)
+        {
+            list.add(TestGarbage(value));
+        }
+        addFinished = true;
+    });
+
+    uint32_t lastValue = 0;
+    bool inOrder       = true;
+    auto takeAll       = [&]() {
+        list.takeAll([&](TestGarbage &&garbage) {
+            inOrder   = inOrder && garbage.value == lastValue + 1;
+            lastValue = garbage.value;
+        });
+    };
+
+    while (!addFinished)
+    {
+        takeAll();
+    }
+    addThread.join();
+    takeAll();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(kValueCount, lastValue);
+    EXPECT_TRUE(list.empty());
+}
+}  // anonymous namespace
+}  // namespace vk
+}  // namespace rx
@@ -930,6 +930,10 @@ PFN_vkGetDeviceFaultInfoEXT vkGetDeviceFaultInfoEXT = nullptr;
 // VK_EXT_host_query_reset
 PFN_vkResetQueryPoolEXT vkResetQueryPoolEXT = nullptr;
 
+// VK_KHR_timeline_semaphore
+PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR = nullptr;
+PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR                     = nullptr;
+
 // VK_EXT_transform_feedback
 PFN_vkCmdBindTransformFeedbackBuffersEXT vkCmdBindTransformFeedbackBuffersEXT = nullptr;
 PFN_vkCmdBeginTransformFeedbackEXT vkCmdBeginTransformFeedbackEXT             = nullptr;
@@ -1043,6 +1047,9 @@ PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT           = nullptr;
 PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2KHR = nullptr;
 PFN_vkCmdWriteTimestamp2KHR vkCmdWriteTimestamp2KHR   = nullptr;
 
+// VK_KHR_push_descriptor
+PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = nullptr;
+
 void InitDebugUtilsEXTFunctions(VkInstance instance)
 {
     GET_INSTANCE_FUNC(vkCreateDebugUtilsMessengerEXT);
@@ -1099,6 +1106,13 @@ void InitHostQueryResetFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkResetQueryPoolEXT);
 }
 
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetSemaphoreCounterValueKHR);
+    GET_DEVICE_FUNC(vkWaitSemaphoresKHR);
+}
+
 // VK_KHR_external_fence_fd
 void InitExternalFenceFdFunctions(VkDevice device)
 {
@@ -1192,6 +1206,12 @@ void InitSynchronization2Functions(VkDevice device)
     GET_DEVICE_FUNC(vkCmdWriteTimestamp2KHR);
 }
 
+// VK_KHR_push_descriptor
+void InitPushDescriptorFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdPushDescriptorSetKHR);
+}
+
 #    undef GET_INSTANCE_FUNC
 #    undef GET_DEVICE_FUNC
 
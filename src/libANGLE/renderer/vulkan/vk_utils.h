@@ -1394,6 +1394,9 @@ void InitDeviceFaultFunctions(VkDevice device);
 // VK_EXT_host_query_reset
 void InitHostQueryResetFunctions(VkDevice device);
 
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreFunctions(VkDevice device);
+
 // VK_KHR_external_fence_fd
 void InitExternalFenceFdFunctions(VkDevice device);
 
@@ -1428,6 +1431,9 @@ void InitHostImageCopyFunctions(VkDevice device);
 // VK_KHR_Synchronization2
 void InitSynchronization2Functions(VkDevice device);
 
+// VK_KHR_push_descriptor
+void InitPushDescriptorFunctions(VkDevice device);
+
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
 // Promoted to Vulkan 1.1
@@ -1608,6 +1614,7 @@ enum class RenderPassClosureReason
     TextureReformatToRenderable,
     DeviceLocalBufferMap,
     OutOfReservedQueueSerialForOutsideCommands,
+    ScissoredLoadOpClearThenRenderAreaGrowth,
 
     // UtilsVk
     GenerateMipmapWithDraw,
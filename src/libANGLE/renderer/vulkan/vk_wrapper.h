@@ -260,6 +260,13 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                            VkBuffer dstBuffer,
                            uint32_t regionCount,
                            const VkBufferImageCopy *regions);
+    void copyQueryPoolResults(const QueryPool &queryPool,
+                              uint32_t firstQuery,
+                              uint32_t queryCount,
+                              const Buffer &dstBuffer,
+                              VkDeviceSize dstOffset,
+                              VkDeviceSize stride,
+                              VkQueryResultFlags flags);
     void copyImage(const Image &srcImage,
                    VkImageLayout srcImageLayout,
                    const Image &dstImage,
@@ -343,6 +350,11 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                        uint32_t offset,
                        uint32_t size,
                        const void *data);
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           DescriptorSetIndex set,
+                           uint32_t descriptorWriteCount,
+                           const VkWriteDescriptorSet *descriptorWrites);
 
     void setBlendConstants(const float blendConstants[4]);
     void setCullMode(VkCullModeFlags cullMode);
@@ -476,7 +488,12 @@ class Semaphore final : public WrappedObject<Semaphore, VkSemaphore>
     void destroy(VkDevice device);
 
     VkResult init(VkDevice device);
+    VkResult initTimeline(VkDevice device, uint64_t initialValue);
     VkResult importFd(VkDevice device, const VkImportSemaphoreFdInfoKHR &importFdInfo) const;
+
+    // Timeline semaphores only.
+    VkResult getCounterValue(VkDevice device, uint64_t *valueOut) const;
+    VkResult wait(VkDevice device, uint64_t value, uint64_t timeout) const;
 };
 
 class Framebuffer final : public WrappedObject<Framebuffer, VkFramebuffer>
@@ -959,6 +976,19 @@ ANGLE_INLINE void CommandBuffer::copyImageToBuffer(const Image &srcImage,
     vkCmdCopyImageToBuffer(mHandle, srcImage.getHandle(), srcImageLayout, dstBuffer, 1, regions);
 }
 
+ANGLE_INLINE void CommandBuffer::copyQueryPoolResults(const QueryPool &queryPool,
+                                                      uint32_t firstQuery,
+                                                      uint32_t queryCount,
+                                                      const Buffer &dstBuffer,
+                                                      VkDeviceSize dstOffset,
+                                                      VkDeviceSize stride,
+                                                      VkQueryResultFlags flags)
+{
+    ASSERT(valid() && queryPool.valid() && dstBuffer.valid());
+    vkCmdCopyQueryPoolResults(mHandle, queryPool.getHandle(), firstQuery, queryCount,
+                              dstBuffer.getHandle(), dstOffset, stride, flags);
+}
+
 ANGLE_INLINE void CommandBuffer::clearColorImage(const Image &image,
                                                  VkImageLayout imageLayout,
                                                  const VkClearColorValue &color,
@@ -1086,6 +1116,18 @@ ANGLE_INLINE void CommandBuffer::pushConstants(const PipelineLayout &layout,
     vkCmdPushConstants(mHandle, layout.getHandle(), flag, 0, size, data);
 }
 
+ANGLE_INLINE void CommandBuffer::pushDescriptorSet(const PipelineLayout &layout,
+                                                   VkPipelineBindPoint pipelineBindPoint,
+                                                   DescriptorSetIndex set,
+                                                   uint32_t descriptorWriteCount,
+                                                   const VkWriteDescriptorSet *descriptorWrites)
+{
+    ASSERT(valid() && layout.valid());
+    ASSERT(vkCmdPushDescriptorSetKHR);
+    vkCmdPushDescriptorSetKHR(mHandle, pipelineBindPoint, layout.getHandle(), ToUnderlying(set),
+                              descriptorWriteCount, descriptorWrites);
+}
+
 ANGLE_INLINE void CommandBuffer::setBlendConstants(const float blendConstants[4])
 {
     ASSERT(valid());
@@ -1577,6 +1619,43 @@ ANGLE_INLINE VkResult Semaphore::init(VkDevice device)
     return vkCreateSemaphore(device, &semaphoreInfo, nullptr, &mHandle);
 }
 
+ANGLE_INLINE VkResult Semaphore::initTimeline(VkDevice device, uint64_t initialValue)
+{
+    ASSERT(!valid());
+
+    VkSemaphoreTypeCreateInfoKHR typeInfo = {};
+    typeInfo.sType                        = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+    typeInfo.semaphoreType                = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+    typeInfo.initialValue                 = initialValue;
+
+    VkSemaphoreCreateInfo semaphoreInfo = {};
+    semaphoreInfo.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext                 = &typeInfo;
+    semaphoreInfo.flags                 = 0;
+
+    return vkCreateSemaphore(device, &semaphoreInfo, nullptr, &mHandle);
+}
+
+ANGLE_INLINE VkResult Semaphore::getCounterValue(VkDevice device, uint64_t *valueOut) const
+{
+    ASSERT(valid());
+    return vkGetSemaphoreCounterValueKHR(device, mHandle, valueOut);
+}
+
+ANGLE_INLINE VkResult Semaphore::wait(VkDevice device, uint64_t value, uint64_t timeout) const
+{
+    ASSERT(valid());
+
+    VkSemaphoreWaitInfoKHR waitInfo = {};
+    waitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    waitInfo.flags                  = 0;
+    waitInfo.semaphoreCount         = 1;
+    waitInfo.pSemaphores            = &mHandle;
+    waitInfo.pValues                = &value;
+
+    return vkWaitSemaphoresKHR(device, &waitInfo, timeout);
+}
+
 ANGLE_INLINE VkResult Semaphore::importFd(VkDevice device,
                                           const VkImportSemaphoreFdInfoKHR &importFdInfo) const
 {
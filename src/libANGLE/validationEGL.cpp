@@ -2355,6 +2355,25 @@ bool ValidateCreatePbufferSurfaceAttributeValue(const ValidationContext *val,
 
     return true;
 }
+
+// eglSwapBuffers and friends may run without the global EGL lock (see ScopedSwapBuffersLock), so
+// they look their surface up with Display::getSurfaceThreadSafe().
+const Surface *ValidateSwapSurface(const ValidationContext *val,
+                                   const Display *display,
+                                   SurfaceID surfaceID)
+{
+    if (!ValidateDisplay(val, display))
+    {
+        return nullptr;
+    }
+
+    const Surface *surface = display->getSurfaceThreadSafe(surfaceID);
+    if (surface == nullptr)
+    {
+        val->setError(EGL_BAD_SURFACE);
+    }
+    return surface;
+}
 }  // anonymous namespace
 
 void ValidationContext::setError(EGLint error) const
@@ -5212,7 +5231,11 @@ bool ValidateDestroyContext(const ValidationContext *val,
 
 bool ValidateSwapBuffers(const ValidationContext *val, const Display *display, SurfaceID surfaceID)
 {
-    ANGLE_VALIDATION_TRY(ValidateSurface(val, display, surfaceID));
+    const Surface *eglSurface = ValidateSwapSurface(val, display, surfaceID);
+    if (eglSurface == nullptr)
+    {
+        return false;
+    }
 
     if (display->isDeviceLost())
     {
@@ -5220,7 +5243,6 @@ bool ValidateSwapBuffers(const ValidationContext *val, const Display *display, S
         return false;
     }
 
-    const Surface *eglSurface = display->getSurface(surfaceID);
     if (eglSurface->isLocked())
     {
         val->setError(EGL_BAD_ACCESS);
@@ -5243,7 +5265,11 @@ bool ValidateSwapBuffersWithDamageKHR(const ValidationContext *val,
                                       const EGLint *rects,
                                       EGLint n_rects)
 {
-    ANGLE_VALIDATION_TRY(ValidateSurface(val, display, surfaceID));
+    const Surface *surface = ValidateSwapSurface(val, display, surfaceID);
+    if (surface == nullptr)
+    {
+        return false;
+    }
 
     if (!display->getExtensions().swapBuffersWithDamage)
     {
@@ -5253,13 +5279,6 @@ bool ValidateSwapBuffersWithDamageKHR(const ValidationContext *val,
         return false;
     }
 
-    const Surface *surface = display->getSurface(surfaceID);
-    if (surface == nullptr)
-    {
-        val->setError(EGL_BAD_SURFACE, "Swap surface cannot be EGL_NO_SURFACE.");
-        return false;
-    }
-
     if (n_rects < 0)
     {
         val->setError(EGL_BAD_PARAMETER, "n_rects cannot be negative.");
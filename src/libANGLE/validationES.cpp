@@ -759,6 +759,85 @@ ANGLE_INLINE const char *ValidateProgramDrawStates(const Context *context,
 
     return errorString;
 }
+
+template <bool kValidateBufferAccess>
+bool ValidateDrawElementsInstancedBaseImpl(const Context *context,
+                                           angle::EntryPoint entryPoint,
+                                           PrimitiveMode mode,
+                                           GLsizei count,
+                                           DrawElementsType type,
+                                           const void *indices,
+                                           GLsizei primcount,
+                                           GLuint baseinstance)
+{
+    if (primcount <= 0)
+    {
+        if (primcount < 0)
+        {
+            ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kNegativePrimcount);
+            return false;
+        }
+
+        // Early exit.
+        return ValidateDrawElementsCommonImpl<kValidateBufferAccess>(context, entryPoint, mode,
+                                                                     count, type, indices,
+                                                                     primcount);
+    }
+
+    if (!ValidateDrawElementsCommonImpl<kValidateBufferAccess>(context, entryPoint, mode, count,
+                                                               type, indices, primcount))
+    {
+        return false;
+    }
+
+    if (count == 0)
+    {
+        // Early exit.
+        return true;
+    }
+
+    return ValidateDrawInstancedAttribs<kValidateBufferAccess>(context, entryPoint, primcount,
+                                                               baseinstance);
+}
+
+template <bool kValidateBufferAccess>
+bool ValidateDrawArraysInstancedBaseImpl(const Context *context,
+                                         angle::EntryPoint entryPoint,
+                                         PrimitiveMode mode,
+                                         GLint first,
+                                         GLsizei count,
+                                         GLsizei primcount,
+                                         GLuint baseinstance)
+{
+    if (primcount <= 0)
+    {
+        if (primcount < 0)
+        {
+            ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kNegativePrimcount);
+            return false;
+        }
+
+        // Early exit.
+        return ValidateDrawArraysCommonImpl<kValidateBufferAccess>(context, entryPoint, mode, first,
+                                                                   count, primcount);
+    }
+
+    if (!ValidateDrawArraysCommonImpl<kValidateBufferAccess>(context, entryPoint, mode, first,
+                                                             count, primcount))
+    {
+        return false;
+    }
+
+    if (count == 0)
+    {
+        // Early exit.
+        return true;
+    }
+
+    return ValidateDrawInstancedAttribs<kValidateBufferAccess>(context, entryPoint, primcount,
+                                                               baseinstance);
+}
+
 }  // anonymous namespace
 
 void SetRobustLengthParam(const GLsizei *length, GLsizei value)
@@ -940,6 +1019,28 @@ bool ValidateTransformFeedbackPrimitiveMode(const Context *context,
     }
 }
 
+bool ValidateDrawArraysCommonWithBufferAccess(const Context *context,
+                                              angle::EntryPoint entryPoint,
+                                              PrimitiveMode mode,
+                                              GLint first,
+                                              GLsizei count,
+                                              GLsizei primcount)
+{
+    return ValidateDrawArraysCommonImpl<true>(context, entryPoint, mode, first, count, primcount);
+}
+
+bool ValidateDrawElementsCommonWithBufferAccess(const Context *context,
+                                                angle::EntryPoint entryPoint,
+                                                PrimitiveMode mode,
+                                                GLsizei count,
+                                                DrawElementsType type,
+                                                const void *indices,
+                                                GLsizei primcount)
+{
+    return ValidateDrawElementsCommonImpl<true>(context, entryPoint, mode, count, type, indices,
+                                                primcount);
+}
+
 bool ValidateDrawElementsInstancedBase(const Context *context,
                                        angle::EntryPoint entryPoint,
                                        PrimitiveMode mode,
@@ -949,31 +1050,14 @@ bool ValidateDrawElementsInstancedBase(const Context *context,
                                        GLsizei primcount,
                                        GLuint baseinstance)
 {
-    if (primcount <= 0)
+    if (ANGLE_UNLIKELY(context->isBufferAccessValidationEnabled()))
     {
-        if (primcount < 0)
-        {
-            ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kNegativePrimcount);
-            return false;
-        }
-
-        // Early exit.
-        return ValidateDrawElementsCommon(context, entryPoint, mode, count, type, indices,
-                                          primcount);
-    }
-
-    if (!ValidateDrawElementsCommon(context, entryPoint, mode, count, type, indices, primcount))
-    {
-        return false;
+        return ValidateDrawElementsInstancedBaseImpl<true>(context, entryPoint, mode, count, type,
+                                                           indices, primcount, baseinstance);
     }
 
-    if (count == 0)
-    {
-        // Early exit.
-        return true;
-    }
-
-    return ValidateDrawInstancedAttribs(context, entryPoint, primcount, baseinstance);
+    return ValidateDrawElementsInstancedBaseImpl<false>(context, entryPoint, mode, count, type,
+                                                        indices, primcount, baseinstance);
 }
 
 bool ValidateDrawArraysInstancedBase(const Context *context,
@@ -984,30 +1068,14 @@ bool ValidateDrawArraysInstancedBase(const Context *context,
                                      GLsizei primcount,
                                      GLuint baseinstance)
 {
-    if (primcount <= 0)
+    if (ANGLE_UNLIKELY(context->isBufferAccessValidationEnabled()))
     {
-        if (primcount < 0)
-        {
-            ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kNegativePrimcount);
-            return false;
-        }
-
-        // Early exit.
-        return ValidateDrawArraysCommon(context, entryPoint, mode, first, count, primcount);
-    }
-
-    if (!ValidateDrawArraysCommon(context, entryPoint, mode, first, count, primcount))
-    {
-        return false;
-    }
-
-    if (count == 0)
-    {
-        // Early exit.
-        return true;
+        return ValidateDrawArraysInstancedBaseImpl<true>(context, entryPoint, mode, first, count,
+                                                         primcount, baseinstance);
     }
 
-    return ValidateDrawInstancedAttribs(context, entryPoint, primcount, baseinstance);
+    return ValidateDrawArraysInstancedBaseImpl<false>(context, entryPoint, mode, first, count,
+                                                      primcount, baseinstance);
 }
 
 bool ValidateDrawInstancedANGLE(const Context *context, angle::EntryPoint entryPoint)
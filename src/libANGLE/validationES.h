@@ -850,12 +850,18 @@ ANGLE_INLINE bool ValidateDrawAttribs(const Context *context,
     return true;
 }
 
+// Draw validation is specialized on whether buffer accesses are validated, which is only the case
+// for WebGL and robust contexts whose backend doesn't support robust buffer access behavior.  That
+// is fixed whenever the context's extensions are (re)initialized, so the draw entry points pick the
+// specialization once per call, and in the common case the buffer access checks compile out.
+template <bool kValidateBufferAccess>
 ANGLE_INLINE bool ValidateDrawArraysAttribs(const Context *context,
                                             angle::EntryPoint entryPoint,
                                             GLint first,
                                             GLsizei count)
 {
-    if (!context->isBufferAccessValidationEnabled())
+    ASSERT(kValidateBufferAccess == context->isBufferAccessValidationEnabled());
+    if (!kValidateBufferAccess)
     {
         return true;
     }
@@ -876,12 +882,14 @@ ANGLE_INLINE bool ValidateDrawArraysAttribs(const Context *context,
     return ValidateDrawAttribs(context, entryPoint, maxVertex);
 }
 
+template <bool kValidateBufferAccess>
 ANGLE_INLINE bool ValidateDrawInstancedAttribs(const Context *context,
                                                angle::EntryPoint entryPoint,
                                                GLint primcount,
                                                GLuint baseinstance)
 {
-    if (ANGLE_LIKELY(!context->isBufferAccessValidationEnabled()))
+    ASSERT(kValidateBufferAccess == context->isBufferAccessValidationEnabled());
+    if (!kValidateBufferAccess)
     {
         return true;
     }
@@ -899,12 +907,13 @@ ANGLE_INLINE bool ValidateDrawInstancedAttribs(const Context *context,
     return true;
 }
 
-ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
-                                           angle::EntryPoint entryPoint,
-                                           PrimitiveMode mode,
-                                           GLint first,
-                                           GLsizei count,
-                                           GLsizei primcount)
+template <bool kValidateBufferAccess>
+ANGLE_INLINE bool ValidateDrawArraysCommonImpl(const Context *context,
+                                               angle::EntryPoint entryPoint,
+                                               PrimitiveMode mode,
+                                               GLint first,
+                                               GLsizei count,
+                                               GLsizei primcount)
 {
     if (ANGLE_UNLIKELY(first < 0))
     {
@@ -952,7 +961,31 @@ ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
         }
     }
 
-    return ValidateDrawArraysAttribs(context, entryPoint, first, count);
+    return ValidateDrawArraysAttribs<kValidateBufferAccess>(context, entryPoint, first, count);
+}
+
+// Out of line, so the buffer access checks aren't inlined in every draw entry point.
+bool ValidateDrawArraysCommonWithBufferAccess(const Context *context,
+                                              angle::EntryPoint entryPoint,
+                                              PrimitiveMode mode,
+                                              GLint first,
+                                              GLsizei count,
+                                              GLsizei primcount);
+
+ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
+                                           angle::EntryPoint entryPoint,
+                                           PrimitiveMode mode,
+                                           GLint first,
+                                           GLsizei count,
+                                           GLsizei primcount)
+{
+    if (ANGLE_UNLIKELY(context->isBufferAccessValidationEnabled()))
+    {
+        return ValidateDrawArraysCommonWithBufferAccess(context, entryPoint, mode, first, count,
+                                                        primcount);
+    }
+
+    return ValidateDrawArraysCommonImpl<false>(context, entryPoint, mode, first, count, primcount);
 }
 
 ANGLE_INLINE bool ValidateDrawElementsBase(const Context *context,
@@ -986,13 +1019,14 @@ ANGLE_INLINE bool ValidateDrawElementsBase(const Context *context,
     return true;
 }
 
-ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
-                                             angle::EntryPoint entryPoint,
-                                             PrimitiveMode mode,
-                                             GLsizei count,
-                                             DrawElementsType type,
-                                             const void *indices,
-                                             GLsizei primcount)
+template <bool kValidateBufferAccess>
+ANGLE_INLINE bool ValidateDrawElementsCommonImpl(const Context *context,
+                                                 angle::EntryPoint entryPoint,
+                                                 PrimitiveMode mode,
+                                                 GLsizei count,
+                                                 DrawElementsType type,
+                                                 const void *indices,
+                                                 GLsizei primcount)
 {
     if (ANGLE_UNLIKELY(!ValidateDrawElementsBase(context, entryPoint, mode, type)))
     {
@@ -1094,7 +1128,8 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
         }
     }
 
-    if (ANGLE_UNLIKELY(context->isBufferAccessValidationEnabled()) && ANGLE_UNLIKELY(primcount > 0))
+    ASSERT(kValidateBufferAccess == context->isBufferAccessValidationEnabled());
+    if (kValidateBufferAccess && ANGLE_UNLIKELY(primcount > 0))
     {
         // Use the parameter buffer to retrieve and cache the index range.
         // TODO: this calculation should take basevertex into account for
@@ -1126,6 +1161,32 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
     return true;
 }
 
+bool ValidateDrawElementsCommonWithBufferAccess(const Context *context,
+                                                angle::EntryPoint entryPoint,
+                                                PrimitiveMode mode,
+                                                GLsizei count,
+                                                DrawElementsType type,
+                                                const void *indices,
+                                                GLsizei primcount);
+
+ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
+                                             angle::EntryPoint entryPoint,
+                                             PrimitiveMode mode,
+                                             GLsizei count,
+                                             DrawElementsType type,
+                                             const void *indices,
+                                             GLsizei primcount)
+{
+    if (ANGLE_UNLIKELY(context->isBufferAccessValidationEnabled()))
+    {
+        return ValidateDrawElementsCommonWithBufferAccess(context, entryPoint, mode, count, type,
+                                                          indices, primcount);
+    }
+
+    return ValidateDrawElementsCommonImpl<false>(context, entryPoint, mode, count, type, indices,
+                                                 primcount);
+}
+
 ANGLE_INLINE bool ValidateBindVertexArrayBase(const Context *context,
                                               angle::EntryPoint entryPoint,
                                               VertexArrayID array)
@@ -37,7 +37,7 @@ ANGLE_INLINE ScopedContextMutexLock GetContextLock_CreateContext(Thread *thread,
                                                                  egl::Display *dpyPacked,
                                                                  gl::ContextID share_contextPacked)
 {
-    return TryLockContext(dpyPacked, share_contextPacked);
+    return TryLockContext(thread, dpyPacked, share_contextPacked);
 }
 
 ANGLE_INLINE ScopedContextMutexLock GetContextLock_CreatePbufferSurface(Thread *thread,
@@ -129,7 +129,7 @@ ANGLE_INLINE ScopedContextMutexLock GetContextLock_QueryContext(Thread *thread,
                                                                 gl::ContextID ctxPacked,
                                                                 EGLint attribute)
 {
-    return TryLockContext(dpyPacked, ctxPacked);
+    return TryLockContext(thread, dpyPacked, ctxPacked);
 }
 
 ANGLE_INLINE ScopedContextMutexLock GetContextLock_QueryString(Thread *thread,
@@ -256,7 +256,7 @@ ANGLE_INLINE ScopedContextMutexLock GetContextLock_CreateImage(Thread *thread,
                                                                egl::Display *dpyPacked,
                                                                gl::ContextID ctxPacked)
 {
-    return TryLockContext(dpyPacked, ctxPacked);
+    return TryLockContext(thread, dpyPacked, ctxPacked);
 }
 
 ANGLE_INLINE ScopedContextMutexLock
@@ -437,7 +437,7 @@ ANGLE_INLINE ScopedContextMutexLock GetContextLock_ReleaseHighPowerGPUANGLE(Thre
                                                                             egl::Display *dpyPacked,
                                                                             gl::ContextID ctxPacked)
 {
-    return TryLockContext(dpyPacked, ctxPacked);
+    return TryLockContext(thread, dpyPacked, ctxPacked);
 }
 
 ANGLE_INLINE ScopedContextMutexLock
@@ -445,7 +445,7 @@ GetContextLock_ReacquireHighPowerGPUANGLE(Thread *thread,
                                           egl::Display *dpyPacked,
                                           gl::ContextID ctxPacked)
 {
-    return TryLockContext(dpyPacked, ctxPacked);
+    return TryLockContext(thread, dpyPacked, ctxPacked);
 }
 
 ANGLE_INLINE ScopedContextMutexLock GetContextLock_HandleGPUSwitchANGLE(Thread *thread,
@@ -531,6 +531,8 @@ ANGLE_INLINE ScopedContextMutexLock GetContextLock_ExportVkImageANGLE(Thread *th
 ANGLE_INLINE ScopedContextMutexLock
 GetContextLock_WaitUntilWorkScheduledANGLE(Thread *thread, egl::Display *dpyPacked)
 {
+    // The calls the current Context offloaded must be scheduled too.
+    FinishCurrentContextOffloadedCalls(thread);
     return {};
 }
 
@@ -654,7 +656,7 @@ ANGLE_INLINE ScopedContextMutexLock GetContextLock_CreateImageKHR(Thread *thread
                                                                   egl::Display *dpyPacked,
                                                                   gl::ContextID ctxPacked)
 {
-    return TryLockContext(dpyPacked, ctxPacked);
+    return TryLockContext(thread, dpyPacked, ctxPacked);
 }
 
 ANGLE_INLINE ScopedContextMutexLock GetContextLock_DestroyImageKHR(Thread *thread,
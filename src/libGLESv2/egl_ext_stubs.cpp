@@ -663,7 +663,8 @@ EGLBoolean SwapBuffersWithDamageKHR(Thread *thread,
                                     const EGLint *rects,
                                     EGLint n_rects)
 {
-    Surface *eglSurface = display->getSurface(surfaceID);
+    Surface *eglSurface = GetSwapSurface(thread, display, surfaceID);
+    std::lock_guard<angle::SimpleMutex> swapLock(eglSurface->getSwapMutex());
 
     ANGLE_EGL_TRY_PREPARE_FOR_CALL_RETURN(thread, display->prepareForCall(),
                                           "eglSwapBuffersWithDamageKHR", GetDisplayIfValid(display),
@@ -694,7 +695,8 @@ void UnlockVulkanQueueANGLE(Thread *thread, egl::Display *display)
 
 EGLBoolean PrepareSwapBuffersANGLE(Thread *thread, Display *display, SurfaceID surfaceID)
 {
-    Surface *eglSurface = display->getSurface(surfaceID);
+    Surface *eglSurface = GetSwapSurface(thread, display, surfaceID);
+    std::lock_guard<angle::SimpleMutex> swapLock(eglSurface->getSwapMutex());
 
     ANGLE_EGL_TRY_PREPARE_FOR_CALL_RETURN(thread, display->prepareForCall(),
                                           "eglPrepareSwapBuffersANGLE", GetDisplayIfValid(display),
@@ -964,6 +966,7 @@ EGLBoolean QuerySurface64KHR(Thread *thread,
                              EGLAttribKHR *value)
 {
     Surface *surface = display->getSurface(surfaceID);
+    std::lock_guard<angle::SimpleMutex> swapLock(surface->getSwapMutex());
 
     ANGLE_EGL_TRY_PREPARE_FOR_CALL_RETURN(thread, display->prepareForCall(), "eglQuerySurface64KHR",
                                           GetDisplayIfValid(display), EGL_FALSE);
@@ -616,6 +616,7 @@ EGLBoolean QuerySurface(Thread *thread,
                         EGLint *value)
 {
     Surface *eglSurface = display->getSurface(surfaceID);
+    std::lock_guard<angle::SimpleMutex> swapLock(eglSurface->getSwapMutex());
 
     ANGLE_EGL_TRY_PREPARE_FOR_CALL_RETURN(thread, display->prepareForCall(), "eglQuerySurface",
                                           GetDisplayIfValid(display), EGL_FALSE);
@@ -705,6 +706,7 @@ EGLBoolean SurfaceAttrib(Thread *thread,
                          EGLint value)
 {
     Surface *eglSurface = display->getSurface(surfaceID);
+    std::lock_guard<angle::SimpleMutex> swapLock(eglSurface->getSwapMutex());
 
     ANGLE_EGL_TRY_PREPARE_FOR_CALL_RETURN(thread, display->prepareForCall(), "eglSurfaceAttrib",
                                           GetDisplayIfValid(display), EGL_FALSE);
@@ -718,7 +720,8 @@ EGLBoolean SurfaceAttrib(Thread *thread,
 
 EGLBoolean SwapBuffers(Thread *thread, Display *display, egl::SurfaceID surfaceID)
 {
-    Surface *eglSurface = display->getSurface(surfaceID);
+    Surface *eglSurface = GetSwapSurface(thread, display, surfaceID);
+    std::lock_guard<angle::SimpleMutex> swapLock(eglSurface->getSwapMutex());
 
     ANGLE_EGL_TRY_PREPARE_FOR_CALL_RETURN(thread, display->prepareForCall(), "eglSwapBuffers",
                                           GetDisplayIfValid(display), EGL_FALSE);
@@ -27,7 +27,13 @@ extern "C" {
 void GL_APIENTRY GL_ActiveTexture(GLenum texture)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLActiveTexture, true, GL_ActiveTexture, texture))
+    {
+        return;
+    }
+
     EVENT(context, GLActiveTexture, "context = %d, texture = %s", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture));
 
@@ -154,7 +160,14 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
 void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBindBuffer, target != GL_ELEMENT_ARRAY_BUFFER,
+                    GL_BindBuffer, target, buffer))
+    {
+        return;
+    }
+
     EVENT(context, GLBindBuffer, "context = %d, target = %s, buffer = %u", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target), buffer);
 
@@ -194,7 +207,14 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
 void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBindFramebuffer, true, GL_BindFramebuffer, target,
+                    framebuffer))
+    {
+        return;
+    }
+
     EVENT(context, GLBindFramebuffer, "context = %d, target = %s, framebuffer = %u", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target), framebuffer);
 
@@ -284,7 +304,14 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
 void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBindTexture, true, GL_BindTexture, target,
+                    texture))
+    {
+        return;
+    }
+
     EVENT(context, GLBindTexture, "context = %d, target = %s, texture = %u", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target), texture);
 
@@ -324,7 +351,14 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
 void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBlendColor, true, GL_BlendColor, red, green, blue,
+                    alpha))
+    {
+        return;
+    }
+
     EVENT(context, GLBlendColor, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
 
@@ -368,7 +402,13 @@ void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 void GL_APIENTRY GL_BlendEquation(GLenum mode)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBlendEquation, true, GL_BlendEquation, mode))
+    {
+        return;
+    }
+
     EVENT(context, GLBlendEquation, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
 
@@ -411,7 +451,14 @@ void GL_APIENTRY GL_BlendEquation(GLenum mode)
 void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBlendEquationSeparate, true,
+                    GL_BlendEquationSeparate, modeRGB, modeAlpha))
+    {
+        return;
+    }
+
     EVENT(context, GLBlendEquationSeparate, "context = %d, modeRGB = %s, modeAlpha = %s",
           CID(context), GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
           GLenumToString(GLESEnum::BlendEquationModeEXT, modeAlpha));
@@ -456,7 +503,13 @@ void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 void GL_APIENTRY GL_BlendFunc(GLenum sfactor, GLenum dfactor)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBlendFunc, true, GL_BlendFunc, sfactor, dfactor))
+    {
+        return;
+    }
+
     EVENT(context, GLBlendFunc, "context = %d, sfactor = %s, dfactor = %s", CID(context),
           GLenumToString(GLESEnum::BlendingFactor, sfactor),
           GLenumToString(GLESEnum::BlendingFactor, dfactor));
@@ -499,7 +552,14 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
                                       GLenum dfactorAlpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLBlendFuncSeparate, true, GL_BlendFuncSeparate,
+                    sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+    {
+        return;
+    }
+
     EVENT(context, GLBlendFuncSeparate,
           "context = %d, sfactorRGB = %s, dfactorRGB = %s, sfactorAlpha = %s, dfactorAlpha = %s",
           CID(context), GLenumToString(GLESEnum::BlendingFactor, sfactorRGB),
@@ -684,7 +744,13 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
 void GL_APIENTRY GL_Clear(GLbitfield mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLClear, true, GL_Clear, mask))
+    {
+        return;
+    }
+
     EVENT(context, GLClear, "context = %d, mask = %s", CID(context),
           GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str());
 
@@ -721,7 +787,14 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
 void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLClearColor, true, GL_ClearColor, red, green, blue,
+                    alpha))
+    {
+        return;
+    }
+
     EVENT(context, GLClearColor, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
 
@@ -761,7 +834,13 @@ void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 void GL_APIENTRY GL_ClearDepthf(GLfloat d)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLClearDepthf, true, GL_ClearDepthf, d))
+    {
+        return;
+    }
+
     EVENT(context, GLClearDepthf, "context = %d, d = %f", CID(context), d);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -799,7 +878,13 @@ void GL_APIENTRY GL_ClearDepthf(GLfloat d)
 void GL_APIENTRY GL_ClearStencil(GLint s)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLClearStencil, true, GL_ClearStencil, s))
+    {
+        return;
+    }
+
     EVENT(context, GLClearStencil, "context = %d, s = %d", CID(context), s);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -837,7 +922,14 @@ void GL_APIENTRY GL_ClearStencil(GLint s)
 void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLColorMask, true, GL_ColorMask, red, green, blue,
+                    alpha))
+    {
+        return;
+    }
+
     EVENT(context, GLColorMask, "context = %d, red = %s, green = %s, blue = %s, alpha = %s",
           CID(context), GLbooleanToString(red), GLbooleanToString(green), GLbooleanToString(blue),
           GLbooleanToString(alpha));
@@ -1236,7 +1328,13 @@ GLuint GL_APIENTRY GL_CreateShader(GLenum type)
 void GL_APIENTRY GL_CullFace(GLenum mode)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLCullFace, true, GL_CullFace, mode))
+    {
+        return;
+    }
+
     EVENT(context, GLCullFace, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, mode));
 
@@ -1525,7 +1623,13 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
 void GL_APIENTRY GL_DepthFunc(GLenum func)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLDepthFunc, true, GL_DepthFunc, func))
+    {
+        return;
+    }
+
     EVENT(context, GLDepthFunc, "context = %d, func = %s", CID(context),
           GLenumToString(GLESEnum::DepthFunction, func));
 
@@ -1564,7 +1668,13 @@ void GL_APIENTRY GL_DepthFunc(GLenum func)
 void GL_APIENTRY GL_DepthMask(GLboolean flag)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLDepthMask, true, GL_DepthMask, flag))
+    {
+        return;
+    }
+
     EVENT(context, GLDepthMask, "context = %d, flag = %s", CID(context), GLbooleanToString(flag));
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -1684,7 +1794,13 @@ void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
 void GL_APIENTRY GL_Disable(GLenum cap)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLDisable, cap != GL_DEBUG_OUTPUT, GL_Disable, cap))
+    {
+        return;
+    }
+
     EVENT(context, GLDisable, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
 
@@ -1765,7 +1881,14 @@ void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
 void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLDrawArrays, true, GL_DrawArrays, mode, first,
+                    count))
+    {
+        return;
+    }
+
     EVENT(context, GLDrawArrays, "context = %d, mode = %s, first = %d, count = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count);
 
@@ -1804,7 +1927,14 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLDrawElements, true, GL_DrawElements, mode, count,
+                    type, indices))
+    {
+        return;
+    }
+
     EVENT(context, GLDrawElements,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
@@ -1847,7 +1977,13 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
 void GL_APIENTRY GL_Enable(GLenum cap)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLEnable, cap != GL_DEBUG_OUTPUT, GL_Enable, cap))
+    {
+        return;
+    }
+
     EVENT(context, GLEnable, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
 
@@ -2115,7 +2251,13 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
 void GL_APIENTRY GL_FrontFace(GLenum mode)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLFrontFace, true, GL_FrontFace, mode))
+    {
+        return;
+    }
+
     EVENT(context, GLFrontFace, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::FrontFaceDirection, mode));
 
@@ -4038,7 +4180,14 @@ void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
 void GL_APIENTRY GL_PolygonOffset(GLfloat factor, GLfloat units)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLPolygonOffset, true, GL_PolygonOffset, factor,
+                    units))
+    {
+        return;
+    }
+
     EVENT(context, GLPolygonOffset, "context = %d, factor = %f, units = %f", CID(context), factor,
           units);
 
@@ -4258,7 +4407,13 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
 void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLScissor, true, GL_Scissor, x, y, width, height))
+    {
+        return;
+    }
+
     EVENT(context, GLScissor, "context = %d, x = %d, y = %d, width = %d, height = %d", CID(context),
           x, y, width, height);
 
@@ -4397,7 +4552,14 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
 void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLStencilFunc, true, GL_StencilFunc, func, ref,
+                    mask))
+    {
+        return;
+    }
+
     EVENT(context, GLStencilFunc, "context = %d, func = %s, ref = %d, mask = %u", CID(context),
           GLenumToString(GLESEnum::StencilFunction, func), ref, mask);
 
@@ -4481,7 +4643,13 @@ void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLu
 void GL_APIENTRY GL_StencilMask(GLuint mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLStencilMask, true, GL_StencilMask, mask))
+    {
+        return;
+    }
+
     EVENT(context, GLStencilMask, "context = %d, mask = %u", CID(context), mask);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -4562,7 +4730,14 @@ void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
 void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLStencilOp, true, GL_StencilOp, fail, zfail,
+                    zpass))
+    {
+        return;
+    }
+
     EVENT(context, GLStencilOp, "context = %d, fail = %s, zfail = %s, zpass = %s", CID(context),
           GLenumToString(GLESEnum::StencilOp, fail), GLenumToString(GLESEnum::StencilOp, zfail),
           GLenumToString(GLESEnum::StencilOp, zpass));
@@ -4918,7 +5093,13 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
 void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform1f, true, GL_Uniform1f, location, v0))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform1f, "context = %d, location = %d, v0 = %f", CID(context), location, v0);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -4960,7 +5141,14 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform1fv, true, GL_Uniform1fv, location, count,
+                    OffloadedArray<GLfloat>(value, count, 1)))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform1fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5004,7 +5192,13 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform1i, true, GL_Uniform1i, location, v0))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform1i, "context = %d, location = %d, v0 = %d", CID(context), location, v0);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -5046,7 +5240,14 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform1iv, true, GL_Uniform1iv, location, count,
+                    OffloadedArray<GLint>(value, count, 1)))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform1iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5090,7 +5291,13 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform2f, true, GL_Uniform2f, location, v0, v1))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform2f, "context = %d, location = %d, v0 = %f, v1 = %f", CID(context),
           location, v0, v1);
 
@@ -5133,7 +5340,14 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform2fv, true, GL_Uniform2fv, location, count,
+                    OffloadedArray<GLfloat>(value, count, 2)))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform2fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5264,7 +5478,14 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform3f, true, GL_Uniform3f, location, v0, v1,
+                    v2))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform3f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f",
           CID(context), location, v0, v1, v2);
 
@@ -5307,7 +5528,14 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform3fv, true, GL_Uniform3fv, location, count,
+                    OffloadedArray<GLfloat>(value, count, 3)))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform3fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5438,7 +5666,14 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform4f, true, GL_Uniform4f, location, v0, v1,
+                    v2, v3))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform4f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
           CID(context), location, v0, v1, v2, v3);
 
@@ -5481,7 +5716,14 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniform4fv, true, GL_Uniform4fv, location, count,
+                    OffloadedArray<GLfloat>(value, count, 4)))
+    {
+        return;
+    }
+
     EVENT(context, GLUniform4fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5664,7 +5906,14 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniformMatrix3fv, true, GL_UniformMatrix3fv,
+                    location, count, transpose, OffloadedArray<GLfloat>(value, count, 9)))
+    {
+        return;
+    }
+
     EVENT(context, GLUniformMatrix3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -5713,7 +5962,14 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUniformMatrix4fv, true, GL_UniformMatrix4fv,
+                    location, count, transpose, OffloadedArray<GLfloat>(value, count, 16)))
+    {
+        return;
+    }
+
     EVENT(context, GLUniformMatrix4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -5759,7 +6015,13 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
 void GL_APIENTRY GL_UseProgram(GLuint program)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLUseProgram, true, GL_UseProgram, program))
+    {
+        return;
+    }
+
     EVENT(context, GLUseProgram, "context = %d, program = %u", CID(context), program);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -6239,7 +6501,13 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
 void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLViewport, true, GL_Viewport, x, y, width, height))
+    {
+        return;
+    }
+
     EVENT(context, GLViewport, "context = %d, x = %d, y = %d, width = %d, height = %d",
           CID(context), x, y, width, height);
 
@@ -1081,7 +1081,14 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
                                         GLsizei instancecount)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLDrawArraysInstanced, true, GL_DrawArraysInstanced,
+                    mode, first, count, instancecount))
+    {
+        return;
+    }
+
     EVENT(context, GLDrawArraysInstanced,
           "context = %d, mode = %s, first = %d, count = %d, instancecount = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count, instancecount);
@@ -1177,7 +1184,14 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
                                           GLsizei instancecount)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()) &&
+        OffloadCall(context, angle::EntryPoint::GLDrawElementsInstanced, true,
+                    GL_DrawElementsInstanced, mode, count, type, indices, instancecount))
+    {
+        return;
+    }
+
     EVENT(context, GLDrawElementsInstanced,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
           ", instancecount = %d",
@@ -124,7 +124,7 @@ void SetCurrentThreadTLS(Thread *thread)
     gCurrentThread = thread;
 }
 #else
-thread_local Thread *gCurrentThread = nullptr;
+thread_local ANGLE_TLS_CONSTINIT Thread *gCurrentThread = nullptr;
 #endif
 
 gl::Context *GetGlobalLastContext()
@@ -146,7 +146,11 @@ ANGLE_NO_SANITIZE_MEMORY ANGLE_NO_SANITIZE_THREAD Thread *GetCurrentThread()
 #else
     Thread *current = gCurrentThread;
 #endif
-    return (current ? current : AllocateCurrentThread());
+    if (current == nullptr)
+    {
+        return AllocateCurrentThread();
+    }
+    return current;
 }
 
 void SetContextCurrent(Thread *thread, gl::Context *context)
@@ -191,6 +195,20 @@ bool IsEGLValidationEnabled()
 
 namespace gl
 {
+Context *FinishOffloadedCallsAndGetValidContext(Context *context)
+{
+    context->finishOffloadedCalls();
+
+    // The context may have been lost on the offload thread, which only updated that thread's
+    // current valid context.
+    if (context->isContextLost())
+    {
+        SetCurrentValidContext(nullptr);
+        return nullptr;
+    }
+    return context;
+}
+
 void GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint entryPoint)
 {
     // If the client starts issuing GL calls before ANGLE has had a chance to initialize,
@@ -13,6 +13,7 @@
 #include "libANGLE/Debug.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/GlobalMutex.h"
+#include "libANGLE/Surface.h"
 #include "libANGLE/Thread.h"
 #include "libANGLE/features.h"
 #include "libANGLE/validationEGL.h"
@@ -32,7 +33,7 @@ class Thread;
 extern Thread *GetCurrentThreadTLS();
 extern void SetCurrentThreadTLS(Thread *thread);
 #else
-extern thread_local Thread *gCurrentThread;
+extern thread_local ANGLE_TLS_CONSTINIT Thread *gCurrentThread;
 #endif
 
 gl::Context *GetGlobalLastContext();
@@ -54,22 +55,45 @@ class [[nodiscard]] ScopedSyncCurrentContextFromThread
     egl::Thread *const mThread;
 };
 
+// EGL calls that lock a Context (see egl_context_lock_impl.h) observe its state, so they first
+// wait for the GL calls it offloaded (see gl::Context::offloadCall).  Only the Context current to
+// "thread" may have offloaded calls on its behalf.  This must happen before locking, as the offload
+// thread takes the "ContextMutex" for every call.
+ANGLE_INLINE void FinishCurrentContextOffloadedCalls(Thread *thread)
+{
+    gl::Context *context = thread->getContext();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()))
+    {
+        context->finishOffloadedCalls();
+    }
+}
+
 // Tries to lock "ContextMutex" of the Context current to the "thread".
 ANGLE_INLINE ScopedContextMutexLock TryLockCurrentContext(Thread *thread)
 {
     ASSERT(kIsContextMutexEnabled);
+    FinishCurrentContextOffloadedCalls(thread);
     gl::Context *context = thread->getContext();
     return context != nullptr ? ScopedContextMutexLock(context->getContextMutex())
                               : ScopedContextMutexLock();
 }
 
 // Tries to lock "ContextMutex" of the Context with "contextID" if it is valid.
-ANGLE_INLINE ScopedContextMutexLock TryLockContext(Display *display, gl::ContextID contextID)
+ANGLE_INLINE ScopedContextMutexLock TryLockContext(Thread *thread,
+                                                   Display *display,
+                                                   gl::ContextID contextID)
 {
     ASSERT(kIsContextMutexEnabled);
     gl::Context *context = GetContextIfValid(display, contextID);
-    return context != nullptr ? ScopedContextMutexLock(context->getContextMutex())
-                              : ScopedContextMutexLock();
+    if (context == nullptr)
+    {
+        return ScopedContextMutexLock();
+    }
+    if (context == thread->getContext())
+    {
+        FinishCurrentContextOffloadedCalls(thread);
+    }
+    return ScopedContextMutexLock(context->getContextMutex());
 }
 
 // Locks "ContextMutex" of the "context" and then tries to merge it with the "ContextMutex" of the
@@ -92,6 +116,65 @@ ANGLE_INLINE ScopedContextMutexLock LockAndTryMergeContextMutexes(gl::Context *c
     return lock;
 }
 
+// Used by eglSwapBuffers and friends instead of the global EGL lock.  If "surfaceID" is the draw
+// surface current to "thread" and the backend allows it, the global lock is not taken.  This is
+// safe because:
+//
+// - Another thread can neither destroy a surface nor terminate a display that is current to this
+//   thread, only mark them for destruction.
+// - The current context is locked by ANGLE_EGL_SCOPED_CONTEXT_LOCK.
+// - Display::getSurface() is protected by DisplayState::surfaceMapMutex.
+// - The surface itself is protected by Surface::getSwapMutex() in the entry point implementations.
+//
+// Capture, and builds where the global mutex is recursive or the context mutex is disabled, always
+// take the global lock.
+class [[nodiscard]] ScopedSwapBuffersLock final : angle::NonCopyable
+{
+  public:
+    ScopedSwapBuffersLock(Thread *thread, const Display *display, SurfaceID surfaceID)
+        : mGlobalMutexLock(!canSwapWithoutGlobalLock(thread, display, surfaceID))
+    {}
+
+  private:
+    static bool canSwapWithoutGlobalLock(Thread *thread,
+                                         const Display *display,
+                                         SurfaceID surfaceID)
+    {
+#if defined(ANGLE_ENABLE_CONTEXT_MUTEX) && !defined(ANGLE_ENABLE_GLOBAL_MUTEX_RECURSION) && \
+    !ANGLE_CAPTURE_ENABLED
+        const gl::Context *context = thread->getContext();
+        const Surface *drawSurface = thread->getCurrentDrawSurface();
+        // The display is only dereferenced once it is known to be the one of the current context,
+        // as it is otherwise not yet validated.
+        return context != nullptr && drawSurface != nullptr && drawSurface->id() == surfaceID &&
+               context->getDisplay() == display &&
+               context->getDisplay()->getFrontendFeatures().swapBuffersWithoutGlobalLock.enabled;
+#else
+        ANGLE_UNUSED_VARIABLE(thread);
+        ANGLE_UNUSED_VARIABLE(display);
+        ANGLE_UNUSED_VARIABLE(surfaceID);
+        return false;
+#endif
+    }
+
+    ScopedOptionalGlobalMutexLock mGlobalMutexLock;
+};
+
+// Returns the surface eglSwapBuffers and friends operate on.  Without the global EGL lock, the
+// surface may be removed from the display by another thread after validation.  The draw surface
+// current to |thread| stays alive until it is no longer current, so it is used without a lookup.
+ANGLE_INLINE Surface *GetSwapSurface(Thread *thread, Display *display, SurfaceID surfaceID)
+{
+    Surface *drawSurface = thread->getCurrentDrawSurface();
+    if (drawSurface != nullptr && drawSurface->id() == surfaceID)
+    {
+        return drawSurface;
+    }
+
+    // Otherwise the global EGL lock is held.
+    return display->getSurface(surfaceID);
+}
+
 #if !defined(ANGLE_ENABLE_CONTEXT_MUTEX)
 #    define ANGLE_EGL_SCOPED_CONTEXT_LOCK(EP, THREAD, ...)
 #else
@@ -102,6 +185,9 @@ ANGLE_INLINE ScopedContextMutexLock LockAndTryMergeContextMutexes(gl::Context *c
 }  // namespace egl
 
 #define ANGLE_SCOPED_GLOBAL_LOCK() egl::ScopedGlobalEGLMutexLock globalMutexLock
+#define ANGLE_SCOPED_SWAP_BUFFERS_LOCK(THREAD, DPY, SURFACE)                              \
+    egl::ScopedSwapBuffersLock globalMutexLock(THREAD, egl::PackParam<egl::Display *>(DPY), \
+                                               egl::PackParam<egl::SurfaceID>(SURFACE))
 #if ANGLE_CAPTURE_ENABLED
 #    define ANGLE_SCOPED_GLOBAL_EGL_AND_EGL_SYNC_LOCK() \
         egl::ScopedGlobalEGLMutexLock globalMutexLock
@@ -128,10 +214,17 @@ ANGLE_INLINE Context *GetGlobalContext()
     egl::Thread *currentThread = egl::gCurrentThread;
 #endif
     ASSERT(currentThread);
-    return currentThread->getContext();
+    Context *context = currentThread->getContext();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()))
+    {
+        context->finishOffloadedCalls();
+    }
+    return context;
 }
 
-ANGLE_INLINE Context *GetValidGlobalContext()
+// Entry points that may offload their call (see Context::offloadCall) use this directly.  All
+// other entry points use GetValidGlobalContext(), which first waits for offloaded calls.
+ANGLE_INLINE Context *GetValidGlobalContextForOffload()
 {
 #if defined(ANGLE_USE_ANDROID_TLS_SLOT)
     // TODO: Replace this branch with a compile time flag (http://anglebug.com/42263361)
@@ -148,6 +241,19 @@ ANGLE_INLINE Context *GetValidGlobalContext()
 #endif
 }
 
+// Waits for the calls offloaded by |context|.  Returns nullptr if one of them lost the context.
+Context *FinishOffloadedCallsAndGetValidContext(Context *context);
+
+ANGLE_INLINE Context *GetValidGlobalContext()
+{
+    Context *context = GetValidGlobalContextForOffload();
+    if (ANGLE_UNLIKELY(context != nullptr && context->isOffloadingCalls()))
+    {
+        return FinishOffloadedCallsAndGetValidContext(context);
+    }
+    return context;
+}
+
 // Generate a context lost error on the context if it is non-null and lost.
 void GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint entryPoint);
 
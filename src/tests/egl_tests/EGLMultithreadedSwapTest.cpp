@@ -0,0 +1,242 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLMultithreadedSwapTest:
+//   Tests eglSwapBuffers racing with EGL calls on the same display from other threads.  With the
+//   swapBuffersWithoutGlobalLock feature, the swap of the current surface does not take the global
+//   EGL lock.
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "test_utils/ANGLETest.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr EGLint kPbufferSize        = 16;
+constexpr int kMinSwapCount          = 200;
+constexpr int kSwapCountAfterRaceEnd = 10;
+
+class EGLMultithreadedSwapTest : public ANGLETest<>
+{
+  protected:
+    void testSetUp() override
+    {
+        ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+        // Use a display of the test's own, as some tests terminate it.
+        std::vector<const char *> enabledFeatures;
+        for (Feature feature : GetParam().eglParameters.enabledFeatureOverrides)
+        {
+            enabledFeatures.push_back(GetFeatureName(feature));
+        }
+        enabledFeatures.push_back(nullptr);
+
+        std::vector<const char *> disabledFeatures;
+        for (Feature feature : GetParam().eglParameters.disabledFeatureOverrides)
+        {
+            disabledFeatures.push_back(GetFeatureName(feature));
+        }
+        disabledFeatures.push_back(nullptr);
+
+        const EGLAttrib displayAttributes[] = {
+            EGL_PLATFORM_ANGLE_TYPE_ANGLE,
+            GetParam().getRenderer(),
+            EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE,
+            GetParam().getDeviceType(),
+            EGL_FEATURE_OVERRIDES_ENABLED_ANGLE,
+            reinterpret_cast<EGLAttrib>(enabledFeatures.data()),
+            EGL_FEATURE_OVERRIDES_DISABLED_ANGLE,
+            reinterpret_cast<EGLAttrib>(disabledFeatures.data()),
+            EGL_NONE,
+        };
+        mDisplay = eglGetPlatformDisplay(EGL_PLATFORM_ANGLE_ANGLE,
+                                         reinterpret_cast<void *>(EGL_DEFAULT_DISPLAY),
+                                         displayAttributes);
+        ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+        ASSERT_EGL_TRUE(eglInitialize(mDisplay, nullptr, nullptr));
+
+        const EGLint configAttributes[] = {EGL_RED_SIZE,     8,
+                                           EGL_GREEN_SIZE,   8,
+                                           EGL_BLUE_SIZE,    8,
+                                           EGL_ALPHA_SIZE,   8,
+                                           EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                           EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+                                           EGL_NONE};
+        EGLint configCount = 0;
+        ASSERT_EGL_TRUE(eglChooseConfig(mDisplay, configAttributes, &mConfig, 1, &configCount));
+        ASSERT_EQ(1, configCount);
+    }
+
+    void testTearDown() override
+    {
+        if (mDisplay != EGL_NO_DISPLAY)
+        {
+            eglTerminate(mDisplay);
+            mDisplay = EGL_NO_DISPLAY;
+        }
+    }
+
+    EGLSurface createPbuffer()
+    {
+        const EGLint attributes[] = {EGL_WIDTH, kPbufferSize, EGL_HEIGHT, kPbufferSize, EGL_NONE};
+        return eglCreatePbufferSurface(mDisplay, mConfig, attributes);
+    }
+
+    // Starts a thread that makes a new context and |surface| current and swaps |surface| until
+    // |raceOver| is set, then swaps a few more times.  Each swap is checked by |checkSwap|, which
+    // is told whether |raceOver| was set before the swap.
+    std::thread startSwapThread(EGLSurface surface,
+                                const std::atomic<bool> &raceOver,
+                                std::atomic<int> *swapCount,
+                                std::function<void(EGLBoolean result, bool raceWasOver)> checkSwap)
+    {
+        return std::thread([this, surface, &raceOver, swapCount, checkSwap]() {
+            const EGLint contextAttributes[] = {EGL_CONTEXT_MAJOR_VERSION, 3, EGL_NONE};
+            EGLContext context =
+                eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttributes);
+            ASSERT_NE(EGL_NO_CONTEXT, context);
+            ASSERT_EGL_TRUE(eglMakeCurrent(mDisplay, surface, surface, context));
+
+            int swapsAfterRace = 0;
+            while (swapsAfterRace < kSwapCountAfterRaceEnd)
+            {
+                const bool raceWasOver = raceOver.load();
+                glClearColor(0, 1, 0, 1);
+                glClear(GL_COLOR_BUFFER_BIT);
+                checkSwap(eglSwapBuffers(mDisplay, surface), raceWasOver);
+                ++*swapCount;
+                swapsAfterRace += raceWasOver ? 1 : 0;
+            }
+
+            // Destroys the context and, if it was destroyed by the other thread, the surface.
+            eglDestroyContext(mDisplay, context);
+            EXPECT_EGL_TRUE(eglReleaseThread());
+        });
+    }
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+    EGLConfig mConfig   = nullptr;
+};
+
+// Test that eglQuerySurface on another thread is serialized with the swaps of the surface.
+TEST_P(EGLMultithreadedSwapTest, QuerySurfaceDuringSwap)
+{
+    EGLSurface surface = createPbuffer();
+    ASSERT_NE(EGL_NO_SURFACE, surface);
+
+    std::atomic<bool> raceOver(false);
+    std::atomic<int> swapCount(0);
+    std::thread swapThread =
+        startSwapThread(surface, raceOver, &swapCount,
+                        [](EGLBoolean result, bool) { EXPECT_EGL_TRUE(result); });
+
+    while (swapCount.load() < kMinSwapCount)
+    {
+        EGLint width = 0;
+        EXPECT_EGL_TRUE(eglQuerySurface(mDisplay, surface, EGL_WIDTH, &width));
+        EXPECT_EQ(kPbufferSize, width);
+    }
+    raceOver = true;
+    swapThread.join();
+
+    EXPECT_EGL_TRUE(eglDestroySurface(mDisplay, surface));
+}
+
+// Test that eglSurfaceAttrib on another thread is serialized with the swaps of the surface.
+TEST_P(EGLMultithreadedSwapTest, SurfaceAttribDuringSwap)
+{
+    EGLSurface surface = createPbuffer();
+    ASSERT_NE(EGL_NO_SURFACE, surface);
+
+    std::atomic<bool> raceOver(false);
+    std::atomic<int> swapCount(0);
+    std::thread swapThread =
+        startSwapThread(surface, raceOver, &swapCount,
+                        [](EGLBoolean result, bool) { EXPECT_EGL_TRUE(result); });
+
+    while (swapCount.load() < kMinSwapCount)
+    {
+        EXPECT_EGL_TRUE(
+            eglSurfaceAttrib(mDisplay, surface, EGL_SWAP_BEHAVIOR, EGL_BUFFER_DESTROYED));
+    }
+    raceOver = true;
+    swapThread.join();
+
+    EXPECT_EGL_TRUE(eglDestroySurface(mDisplay, surface));
+}
+
+// Test creating and destroying surfaces on another thread while swapping, then destroying the
+// surface being swapped.  Swaps fail once the surface is destroyed, but the surface stays alive
+// until it is no longer current.
+TEST_P(EGLMultithreadedSwapTest, DestroySurfaceDuringSwap)
+{
+    EGLSurface surface = createPbuffer();
+    ASSERT_NE(EGL_NO_SURFACE, surface);
+
+    std::atomic<bool> raceOver(false);
+    std::atomic<int> swapCount(0);
+    std::thread swapThread = startSwapThread(
+        surface, raceOver, &swapCount, [](EGLBoolean result, bool raceWasOver) {
+            if (raceWasOver || result == EGL_FALSE)
+            {
+                EXPECT_EGL_FALSE(result);
+                EXPECT_EGL_ERROR(EGL_BAD_SURFACE);
+            }
+        });
+
+    while (swapCount.load() < kMinSwapCount)
+    {
+        EGLSurface otherSurface = createPbuffer();
+        EXPECT_NE(EGL_NO_SURFACE, otherSurface);
+        EXPECT_EGL_TRUE(eglDestroySurface(mDisplay, otherSurface));
+    }
+    EXPECT_EGL_TRUE(eglDestroySurface(mDisplay, surface));
+    raceOver = true;
+    swapThread.join();
+}
+
+// Test terminating the display on another thread while swapping.  Swaps fail once the display is
+// terminated, but the surface and context stay alive until they are no longer current.
+TEST_P(EGLMultithreadedSwapTest, TerminateDuringSwap)
+{
+    EGLSurface surface = createPbuffer();
+    ASSERT_NE(EGL_NO_SURFACE, surface);
+
+    std::atomic<bool> raceOver(false);
+    std::atomic<int> swapCount(0);
+    std::thread swapThread = startSwapThread(surface, raceOver, &swapCount,
+                                             [](EGLBoolean result, bool raceWasOver) {
+                                                 if (raceWasOver)
+                                                 {
+                                                     EXPECT_EGL_FALSE(result);
+                                                 }
+                                             });
+
+    while (swapCount.load() < kMinSwapCount)
+    {
+        EGLSurface otherSurface = createPbuffer();
+        EXPECT_NE(EGL_NO_SURFACE, otherSurface);
+        EXPECT_EGL_TRUE(eglDestroySurface(mDisplay, otherSurface));
+    }
+    EXPECT_EGL_TRUE(eglTerminate(mDisplay));
+    raceOver = true;
+    swapThread.join();
+}
+}  // anonymous namespace
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMultithreadedSwapTest);
+ANGLE_INSTANTIATE_TEST(EGLMultithreadedSwapTest,
+                       ES3_VULKAN(),
+                       ES3_VULKAN().enable(Feature::SwapBuffersWithoutGlobalLock),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::SwapBuffersWithoutGlobalLock));
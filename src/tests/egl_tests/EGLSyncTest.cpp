@@ -939,6 +939,117 @@ void main(void)
     EXPECT_LT(numLongWaits, kMinLongWaitsToFail);
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(EGLSyncTest,
-                                       ES2_VULKAN().enable(Feature::EnableExtraSubmitFence),
-                                       ES3_VULKAN().enable(Feature::EnableExtraSubmitFence));
+// Test that a fence sync created right after switching to another context of the share group, and
+// waited on from another share group in another thread, covers the rendering of the context that
+// was switched away from.  That rendering is done to an EGLImage, which the waiting thread samples.
+TEST_P(EGLSyncTest, WaitFromOtherShareGroupAfterShareGroupSwitch)
+{
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+
+    ANGLE_SKIP_TEST_IF(!hasFenceSyncExtension());
+    ANGLE_SKIP_TEST_IF(!IsEGLDisplayExtensionEnabled(display, "EGL_KHR_image_base") ||
+                       !IsEGLDisplayExtensionEnabled(display, "EGL_KHR_gl_texture_2D_image"));
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_OES_EGL_image"));
+
+    EGLConfig config = window->getConfig();
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_CLIENT_VERSION, window->getClientMajorVersion(), EGL_CONTEXT_MINOR_VERSION_KHR,
+        window->getClientMinorVersion(), EGL_NONE};
+    const EGLint pbufferAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+
+    // Two contexts of a new share group, neither with a window surface.
+    EGLContext context1 = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    ASSERT_NE(EGL_NO_CONTEXT, context1);
+    EGLContext context2 = eglCreateContext(display, config, context1, contextAttribs);
+    ASSERT_NE(EGL_NO_CONTEXT, context2);
+
+    EGLSurface surface1 = eglCreatePbufferSurface(display, config, pbufferAttribs);
+    ASSERT_NE(EGL_NO_SURFACE, surface1);
+    EGLSurface surface2 = eglCreatePbufferSurface(display, config, pbufferAttribs);
+    ASSERT_NE(EGL_NO_SURFACE, surface2);
+
+    // Draw red to a texture in context 1, and share it with an EGLImage.
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface1, surface1, context1));
+
+    GLuint sourceTexture = 0;
+    glGenTextures(1, &sourceTexture);
+    glBindTexture(GL_TEXTURE_2D, sourceTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    EGLImageKHR image = eglCreateImageKHR(
+        display, context1, EGL_GL_TEXTURE_2D_KHR,
+        reinterpret_cast<EGLClientBuffer>(static_cast<uintptr_t>(sourceTexture)), nullptr);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_NE(EGL_NO_IMAGE_KHR, image);
+
+    {
+        GLFramebuffer framebuffer;
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, sourceTexture,
+                               0);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+        ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+        drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    // Switch to context 2 of the same share group, and create a fence sync there.
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface2, surface2, context2));
+
+    EGLSyncKHR sync = eglCreateSyncKHR(display, EGL_SYNC_FENCE_KHR, nullptr);
+    ASSERT_NE(EGL_NO_SYNC_KHR, sync);
+
+    // While context 2 remains current, wait on the sync from a context of another share group in
+    // another thread, then verify that the EGLImage contains the rendering of context 1.
+    std::thread waitThread([&]() {
+        EGLContext context3 = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, context3);
+        EGLSurface surface3 = eglCreatePbufferSurface(display, config, pbufferAttribs);
+        ASSERT_NE(EGL_NO_SURFACE, surface3);
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(display, surface3, surface3, context3));
+
+        constexpr GLuint64 kTimeout = 1'000'000'000;  // 1 second
+        EXPECT_EQ(EGL_CONDITION_SATISFIED_KHR, eglClientWaitSyncKHR(display, sync, 0, kTimeout));
+
+        {
+            GLTexture targetTexture;
+            glBindTexture(GL_TEXTURE_2D, targetTexture);
+            glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image);
+
+            GLFramebuffer framebuffer;
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                                   targetTexture, 0);
+            ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+            EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+        }
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        EXPECT_EGL_TRUE(eglDestroySurface(display, surface3));
+        EXPECT_EGL_TRUE(eglDestroyContext(display, context3));
+    });
+    waitThread.join();
+
+    EXPECT_EGL_TRUE(eglDestroySyncKHR(display, sync));
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface1, surface1, context1));
+    glDeleteTextures(1, &sourceTexture);
+    EXPECT_EGL_TRUE(eglDestroyImageKHR(display, image));
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, window->getSurface(), window->getSurface(),
+                                   window->getContext()));
+    EXPECT_EGL_TRUE(eglDestroySurface(display, surface1));
+    EXPECT_EGL_TRUE(eglDestroySurface(display, surface2));
+    EXPECT_EGL_TRUE(eglDestroyContext(display, context1));
+    EXPECT_EGL_TRUE(eglDestroyContext(display, context2));
+}
+
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    EGLSyncTest,
+    ES2_VULKAN().enable(Feature::EnableExtraSubmitFence),
+    ES3_VULKAN().enable(Feature::EnableExtraSubmitFence),
+    ES3_VULKAN().enable(Feature::DeferSubmissionOnShareGroupContextSwitch));
@@ -652,6 +652,70 @@ void main()
     EXPECT_GL_NO_ERROR();
 }
 
+// Test that a buffer written by the GPU and mapped for reading every frame always reads back the
+// latest data, including when it is written again after a flush and before the map.
+TEST_P(BufferDataTestES3, CopyBufferSubDataMapReadEveryFrame)
+{
+    constexpr size_t kBufferSize = 64;
+    constexpr uint32_t kFrames   = 8;
+
+    std::vector<uint8_t> srcData(kBufferSize, 0);
+    GLBuffer srcBuffer;
+    glBindBuffer(GL_COPY_READ_BUFFER, srcBuffer);
+    glBufferData(GL_COPY_READ_BUFFER, kBufferSize, srcData.data(), GL_STATIC_DRAW);
+
+    GLBuffer dstBuffer;
+    glBindBuffer(GL_COPY_WRITE_BUFFER, dstBuffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, kBufferSize, nullptr, GL_STATIC_DRAW);
+    ASSERT_GL_NO_ERROR();
+
+    auto copyAndCheck = [&](uint8_t value, bool flushBeforeRewrite) {
+        std::fill(srcData.begin(), srcData.end(), value);
+        glBufferSubData(GL_COPY_READ_BUFFER, 0, kBufferSize, srcData.data());
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, kBufferSize);
+
+        if (flushBeforeRewrite)
+        {
+            // Submit the copy, then overwrite the second half of the destination.
+            glFlush();
+            std::fill(srcData.begin(), srcData.end(), static_cast<uint8_t>(value + 1));
+            glBufferSubData(GL_COPY_READ_BUFFER, 0, kBufferSize, srcData.data());
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, kBufferSize / 2,
+                                kBufferSize / 2, kBufferSize / 2);
+        }
+
+        const uint8_t *data = reinterpret_cast<const uint8_t *>(
+            glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, kBufferSize, GL_MAP_READ_BIT));
+        ASSERT_NE(data, nullptr);
+        for (size_t i = 0; i < kBufferSize; ++i)
+        {
+            const bool rewritten = flushBeforeRewrite && i >= kBufferSize / 2;
+            const uint8_t expect = rewritten ? static_cast<uint8_t>(value + 1) : value;
+            EXPECT_EQ(expect, data[i]) << "value " << static_cast<int>(value) << " at " << i;
+        }
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        ASSERT_GL_NO_ERROR();
+    };
+
+    for (uint32_t frame = 0; frame < kFrames; ++frame)
+    {
+        copyAndCheck(static_cast<uint8_t>(frame * 2), frame % 3 == 2);
+        swapBuffers();
+    }
+
+    // Map only a range of the buffer.
+    copyAndCheck(100, false);
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(glMapBufferRange(
+        GL_COPY_WRITE_BUFFER, kBufferSize / 4, kBufferSize / 4, GL_MAP_READ_BIT));
+    ASSERT_NE(data, nullptr);
+    for (size_t i = 0; i < kBufferSize / 4; ++i)
+    {
+        EXPECT_EQ(100u, data[i]);
+    }
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test to verify mapping a buffer after copying to it contains expected data
 // with GL_MAP_UNSYNCHRONIZED_BIT
 TEST_P(BufferDataTestES3, MapBufferUnsynchronizedReadTest)
@@ -2387,6 +2451,9 @@ ANGLE_INSTANTIATE_TEST_COMBINE_1(BufferSubDataTest,
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BufferDataTestES3);
 ANGLE_INSTANTIATE_TEST_ES3_AND(BufferDataTestES3,
                                ES3_VULKAN().enable(Feature::PreferCPUForBufferSubData),
+                               ES3_VULKAN().enable(Feature::BudgetAwareAllocation),
+                               ES3_VULKAN().enable(
+                                   Feature::SpeculativeReadbackForDeviceLocalBuffers),
                                ES3_METAL().enable(Feature::ForceBufferGPUStorage));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BufferStorageTestES3);
@@ -358,7 +358,15 @@ TEST_P(FenceSyncTest, MultipleFenceDraw)
     }
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(FenceNVTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    FenceNVTest,
+    ES2_VULKAN().enable(Feature::UseTimelineSemaphoreForSubmissions),
+    ES3_VULKAN().enable(Feature::UseTimelineSemaphoreForSubmissions));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FenceSyncTest);
-ANGLE_INSTANTIATE_TEST_ES3(FenceSyncTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(FenceSyncTest,
+                               ES3_VULKAN().enable(Feature::AsyncQueueSubmit),
+                               ES3_VULKAN().enable(Feature::UseTimelineSemaphoreForSubmissions),
+                               ES3_VULKAN()
+                                   .enable(Feature::AsyncQueueSubmit)
+                                   .enable(Feature::UseTimelineSemaphoreForSubmissions));
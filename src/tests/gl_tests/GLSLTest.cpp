@@ -8180,6 +8180,55 @@ TEST_P(GLSLTest_ES3, InactiveVaryingStructUnusedInFragmentShader)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Test that inactive varyings whose calculation uses uniforms, textures and temporaries that are
+// shared with active varyings work.  The computation of the inactive varyings and the resources
+// only they use may be removed at link time.
+TEST_P(GLSLTest_ES3, InactiveVaryingsWithSharedComputation)
+{
+    constexpr char kVS[] = R"(#version 300 es
+in vec4 inputAttribute;
+uniform vec4 sharedUniform;
+uniform vec4 unusedUniform;
+uniform sampler2D unusedSampler;
+out vec4 active;
+out vec4 inactive1;
+out vec4 inactive2;
+void main()
+{
+    gl_Position = inputAttribute;
+    vec4 base = sharedUniform * 2.0;
+    vec4 temp = base + unusedUniform;
+    inactive1 = temp * textureLod(unusedSampler, vec2(0.5), 0.0);
+    inactive2 = vec4(dot(temp, base));
+    active = base * 0.5;
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+in vec4 active;
+in vec4 inactive1;
+out vec4 col;
+void main()
+{
+    col = active;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+
+    GLint sharedLocation = glGetUniformLocation(program, "sharedUniform");
+    ASSERT_NE(-1, sharedLocation);
+    glUniform4f(sharedLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    GLint unusedLocation = glGetUniformLocation(program, "unusedUniform");
+    ASSERT_NE(-1, unusedLocation);
+    glUniform4f(unusedLocation, 1.0f, 0.0f, 1.0f, 0.0f);
+
+    drawQuad(program, "inputAttribute", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test that multiple varying matrices that get used in the fragment shader work.
 TEST_P(GLSLTest_ES3, VaryingMatrices)
 {
@@ -631,6 +631,124 @@ TEST_P(LinkAndRelinkTest, AttachShaderThenCompile)
     ASSERT_GL_NO_ERROR();
 }
 
+// Relink a program after replacing only its fragment shader.  The attribute locations should be
+// the same as in the previous link, and the program should render with the new fragment shader.
+TEST_P(LinkAndRelinkTest, RelinkWithOnlyFragmentShaderChanged)
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+attribute vec4 a_color;
+varying vec4 v_color;
+void main()
+{
+    gl_Position = a_position;
+    v_color = a_color;
+})";
+    constexpr char kRedFS[] = R"(precision mediump float;
+varying vec4 v_color;
+void main()
+{
+    gl_FragColor = vec4(1, 0, 0, 1) + v_color * 0.0;
+})";
+    constexpr char kVaryingFS[] = R"(precision mediump float;
+varying vec4 v_color;
+void main()
+{
+    gl_FragColor = v_color;
+})";
+
+    GLuint program = glCreateProgram();
+    GLShader vs(GL_VERTEX_SHADER);
+    GLShader redFS(GL_FRAGMENT_SHADER);
+    GLShader varyingFS(GL_FRAGMENT_SHADER);
+
+    const char *source = kVS;
+    glShaderSource(vs, 1, &source, nullptr);
+    glCompileShader(vs);
+    source = kRedFS;
+    glShaderSource(redFS, 1, &source, nullptr);
+    glCompileShader(redFS);
+    source = kVaryingFS;
+    glShaderSource(varyingFS, 1, &source, nullptr);
+    glCompileShader(varyingFS);
+
+    glAttachShader(program, vs);
+    glAttachShader(program, redFS);
+    glLinkProgram(program);
+
+    GLint linkStatus;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+
+    const GLint positionLocation = glGetAttribLocation(program, "a_position");
+    const GLint colorLocation    = glGetAttribLocation(program, "a_color");
+    EXPECT_NE(-1, positionLocation);
+    EXPECT_NE(-1, colorLocation);
+
+    // Swap the fragment shader and relink.
+    glDetachShader(program, redFS);
+    glAttachShader(program, varyingFS);
+    glLinkProgram(program);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+
+    EXPECT_EQ(positionLocation, glGetAttribLocation(program, "a_position"));
+    EXPECT_EQ(colorLocation, glGetAttribLocation(program, "a_color"));
+
+    GLint activeAttributes = 0;
+    glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &activeAttributes);
+    EXPECT_EQ(2, activeAttributes);
+
+    glUseProgram(program);
+    glVertexAttrib4f(colorLocation, 0, 1, 0, 1);
+    drawQuad(program, "a_position", 0.5);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Relink a program with the same shaders after changing the attribute bindings.  The new bindings
+// should take effect even though the shaders are unchanged.
+TEST_P(LinkAndRelinkTest, RelinkWithChangedAttribBindings)
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+attribute vec4 a_color;
+varying vec4 v_color;
+void main()
+{
+    gl_Position = a_position;
+    v_color = a_color;
+})";
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_color;
+void main()
+{
+    gl_FragColor = v_color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+
+    glBindAttribLocation(program, 0, "a_color");
+    glBindAttribLocation(program, 1, "a_position");
+    glLinkProgram(program);
+    EXPECT_EQ(0, glGetAttribLocation(program, "a_color"));
+    EXPECT_EQ(1, glGetAttribLocation(program, "a_position"));
+
+    glBindAttribLocation(program, 1, "a_color");
+    glBindAttribLocation(program, 0, "a_position");
+    glLinkProgram(program);
+    EXPECT_EQ(1, glGetAttribLocation(program, "a_color"));
+    EXPECT_EQ(0, glGetAttribLocation(program, "a_position"));
+
+    glUseProgram(program);
+    glVertexAttrib4f(1, 0, 1, 0, 1);
+    drawQuad(program, "a_position", 0.5);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 // If a program is linked successfully once, it should retain its executable if a relink fails.
 TEST_P(LinkAndRelinkTestES3, SuccessfulLinkThenFailingRelink)
 {
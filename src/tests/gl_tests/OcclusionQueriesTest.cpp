@@ -1164,7 +1164,8 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(OcclusionQueriesTest);
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OcclusionQueriesTestES3);
 ANGLE_INSTANTIATE_TEST_ES3_AND(
     OcclusionQueriesTestES3,
-    ES3_VULKAN().enable(Feature::PreferSubmitOnAnySamplesPassedQueryEnd));
+    ES3_VULKAN().enable(Feature::PreferSubmitOnAnySamplesPassedQueryEnd),
+    ES3_VULKAN().enable(Feature::CopyOcclusionQueryResultsToBuffer));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OcclusionQueriesNoSurfaceTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(OcclusionQueriesNoSurfaceTestES3);
@@ -0,0 +1,183 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OffloadGLCallsTest.cpp:
+//   Tests for the offloadGlCallsToWorkerThread feature, where the GL calls commonly made per draw
+//   are validated and executed by a per-context worker thread.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+class OffloadGLCallsTest : public ANGLETest<>
+{
+  protected:
+    OffloadGLCallsTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void setupQuadBuffer(GLuint buffer, GLint positionLocation)
+    {
+        const std::array<Vector3, 6> quadVertices = GetQuadVertices();
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+    }
+};
+
+// Test that offloaded uniform updates use the values at the time of the call, even if the
+// application overwrites its array before the offloaded draw executes.
+TEST_P(OffloadGLCallsTest, UniformArrayIsCopied)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+
+    GLBuffer buffer;
+    setupQuadBuffer(buffer, glGetAttribLocation(program, essl1_shaders::PositionAttrib()));
+
+    GLfloat color[4] = {0.0f, 1.0f, 0.0f, 1.0f};
+    glViewport(0, 0, getWindowWidth(), getWindowHeight());
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUniform4fv(colorLocation, 1, color);
+    color[0] = 1.0f;
+    color[1] = 0.0f;
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that uniform arrays too large to be copied into an offloaded call are set in order with the
+// offloaded calls around them.
+TEST_P(OffloadGLCallsTest, LargeUniformArrayAfterOffloadedCalls)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform vec4 colors[16];
+void main()
+{
+    gl_FragColor = colors[0] + colors[15];
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+    GLint colorsLocation = glGetUniformLocation(program, "colors");
+    ASSERT_NE(-1, colorsLocation);
+
+    GLBuffer buffer;
+    setupQuadBuffer(buffer, glGetAttribLocation(program, essl1_shaders::PositionAttrib()));
+
+    std::array<GLfloat, 16 * 4> colors = {};
+    colors[0 * 4 + 0]                  = 1.0f;
+    colors[0 * 4 + 3]                  = 1.0f;
+    glUniform4fv(colorsLocation, 16, colors.data());
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // The first element is offloaded, the whole array is not.
+    glUniform4fv(colorsLocation, 1, colors.data());
+    colors[0 * 4 + 0]  = 0.0f;
+    colors[15 * 4 + 1] = 1.0f;
+    glUniform4fv(colorsLocation, 16, colors.data());
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that indexed draws and the state set for them through offloaded calls are executed in
+// order with the element array buffer binding, which is not offloaded.
+TEST_P(OffloadGLCallsTest, IndexedDrawsWithOffloadedState)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+
+    GLBuffer buffer;
+    setupQuadBuffer(buffer, glGetAttribLocation(program, essl1_shaders::PositionAttrib()));
+
+    const std::array<GLushort, 6> indices = {0, 1, 2, 3, 4, 5};
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices.data(), GL_STATIC_DRAW);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glUniform4f(colorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    glUniform4f(colorLocation, 0.0f, 0.0f, 1.0f, 1.0f);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    glDisable(GL_BLEND);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::magenta);
+
+    // Without an element array buffer, the draw reads client index data and is not offloaded.
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glUniform4f(colorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices.data());
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that errors generated by offloaded calls are reported by glGetError.
+TEST_P(OffloadGLCallsTest, OffloadedErrorIsReported)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+
+    GLBuffer buffer;
+    setupQuadBuffer(buffer, glGetAttribLocation(program, essl1_shaders::PositionAttrib()));
+
+    glDrawArrays(GL_TRIANGLES, 0, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glDrawArrays(GL_TRIANGLES + 100, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+}
+
+// Test that draws from client memory, which are executed on the calling thread, are ordered with
+// the offloaded calls before them.
+TEST_P(OffloadGLCallsTest, ClientArrayDrawAfterOffloadedCalls)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+
+    const std::array<Vector3, 6> quadVertices = GetQuadVertices();
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, quadVertices.data());
+    glEnableVertexAttribArray(positionLocation);
+
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUniform4f(colorLocation, 0.0f, 0.0f, 1.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+    ASSERT_GL_NO_ERROR();
+}
+}  // anonymous namespace
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OffloadGLCallsTest);
+ANGLE_INSTANTIATE_TEST(OffloadGLCallsTest,
+                       ES2_VULKAN().enable(Feature::OffloadGlCallsToWorkerThread),
+                       ES3_VULKAN().enable(Feature::OffloadGlCallsToWorkerThread),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::OffloadGlCallsToWorkerThread));
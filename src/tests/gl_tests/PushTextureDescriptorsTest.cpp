@@ -0,0 +1,341 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PushTextureDescriptorsTest.cpp: Tests texture bindings in the situations where the Vulkan backend
+// has to push its texture descriptors again when the pushTextureDescriptors feature is enabled.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr int kWindowSize = 16;
+
+class PushTextureDescriptorsTest : public ANGLETest<>
+{
+  protected:
+    PushTextureDescriptorsTest()
+    {
+        setWindowWidth(kWindowSize);
+        setWindowHeight(kWindowSize);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void initTexture(GLuint texture, const GLColor &color)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &color);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    // Limits the following draws to the left or right half of the window.
+    void scissorHalf(bool right)
+    {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(right ? kWindowSize / 2 : 0, 0, kWindowSize / 2, kWindowSize);
+    }
+
+    void expectHalves(const GLColor &left, const GLColor &right)
+    {
+        EXPECT_PIXEL_RECT_EQ(0, 0, kWindowSize / 2, kWindowSize, left);
+        EXPECT_PIXEL_RECT_EQ(kWindowSize / 2, 0, kWindowSize / 2, kWindowSize, right);
+    }
+};
+
+constexpr char kSingleTextureFS[] = R"(#version 310 es
+precision mediump float;
+uniform highp sampler2D tex;
+out vec4 colorOut;
+void main()
+{
+    colorOut = texelFetch(tex, ivec2(0), 0);
+})";
+
+// Test that every element of a sampler array is written, and that changing the texture bound to
+// one element between draws of the same render pass is picked up.
+TEST_P(PushTextureDescriptorsTest, TextureArray)
+{
+    constexpr char kFS[] = R"(#version 310 es
+precision mediump float;
+uniform highp sampler2D tex[4];
+out vec4 colorOut;
+void main()
+{
+    colorOut = vec4(texelFetch(tex[0], ivec2(0), 0).r, texelFetch(tex[1], ivec2(0), 0).g,
+                    texelFetch(tex[2], ivec2(0), 0).b, texelFetch(tex[3], ivec2(0), 0).a);
+})";
+
+    ANGLE_GL_PROGRAM(program, essl31_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+
+    const GLColor kColors[4] = {GLColor::red, GLColor::green, GLColor::blue, GLColor::white};
+    GLTexture textures[4];
+    for (GLuint unit = 0; unit < 4; ++unit)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        initTexture(textures[unit], kColors[unit]);
+    }
+    GLTexture blackTexture;
+    glActiveTexture(GL_TEXTURE4);
+    initTexture(blackTexture, GLColor::black);
+
+    const GLint texLoc = glGetUniformLocation(program, "tex");
+    ASSERT_NE(-1, texLoc);
+    const GLint kUnits[4] = {0, 1, 2, 3};
+    glUniform1iv(texLoc, 4, kUnits);
+
+    scissorHalf(false);
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5);
+
+    // Replace the blue texture of the third element with black.
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, blackTexture);
+
+    scissorHalf(true);
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5);
+    ASSERT_GL_NO_ERROR();
+
+    expectHalves(GLColor::white, GLColor::yellow);
+}
+
+// Test a program with both texture buffers and textures, changing the buffer of the texture buffer
+// between draws of the same render pass.
+TEST_P(PushTextureDescriptorsTest, TexelBuffers)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_OES_texture_buffer"));
+
+    constexpr char kFS[] = R"(#version 310 es
+#extension GL_OES_texture_buffer : require
+precision mediump float;
+uniform highp sampler2D tex;
+uniform highp samplerBuffer texBuffers[2];
+out vec4 colorOut;
+void main()
+{
+    colorOut = vec4(texelFetch(texBuffers[0], 0).r, texelFetch(tex, ivec2(0), 0).g,
+                    texelFetch(texBuffers[1], 0).b, 1);
+})";
+
+    ANGLE_GL_PROGRAM(program, essl31_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+
+    const std::array<GLColor, 1> kRedData   = {GLColor::red};
+    const std::array<GLColor, 1> kBlueData  = {GLColor::blue};
+    const std::array<GLColor, 1> kBlackData = {GLColor::black};
+
+    GLBuffer redBuffer;
+    glBindBuffer(GL_TEXTURE_BUFFER, redBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(kRedData), kRedData.data(), GL_STATIC_DRAW);
+    GLBuffer blueBuffer;
+    glBindBuffer(GL_TEXTURE_BUFFER, blueBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(kBlueData), kBlueData.data(), GL_STATIC_DRAW);
+    GLBuffer blackBuffer;
+    glBindBuffer(GL_TEXTURE_BUFFER, blackBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(kBlackData), kBlackData.data(), GL_STATIC_DRAW);
+
+    GLTexture greenTexture;
+    glActiveTexture(GL_TEXTURE0);
+    initTexture(greenTexture, GLColor::green);
+
+    GLTexture redTextureBuffer;
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_BUFFER, redTextureBuffer);
+    glTexBufferOES(GL_TEXTURE_BUFFER, GL_RGBA8, redBuffer);
+
+    GLTexture blueTextureBuffer;
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_BUFFER, blueTextureBuffer);
+    glTexBufferOES(GL_TEXTURE_BUFFER, GL_RGBA8, blueBuffer);
+    ASSERT_GL_NO_ERROR();
+
+    glUniform1i(glGetUniformLocation(program, "tex"), 0);
+    const GLint kBufferUnits[2] = {1, 2};
+    glUniform1iv(glGetUniformLocation(program, "texBuffers"), 2, kBufferUnits);
+
+    scissorHalf(false);
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5);
+
+    // Point the second texture buffer at the black buffer.
+    glTexBufferOES(GL_TEXTURE_BUFFER, GL_RGBA8, blackBuffer);
+
+    scissorHalf(true);
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5);
+    ASSERT_GL_NO_ERROR();
+
+    expectHalves(GLColor::white, GLColor::yellow);
+}
+
+// Test switching between programs with different texture layouts within a render pass, including
+// switching back to a program whose textures did not change.
+TEST_P(PushTextureDescriptorsTest, ProgramSwitches)
+{
+    constexpr char kTwoTexturesFS[] = R"(#version 310 es
+precision mediump float;
+uniform highp sampler2D texA;
+uniform highp sampler2D texB;
+out vec4 colorOut;
+void main()
+{
+    colorOut = texelFetch(texA, ivec2(0), 0) + texelFetch(texB, ivec2(0), 0);
+})";
+
+    ANGLE_GL_PROGRAM(singleTextureProgram, essl31_shaders::vs::Simple(), kSingleTextureFS);
+    ANGLE_GL_PROGRAM(twoTexturesProgram, essl31_shaders::vs::Simple(), kTwoTexturesFS);
+
+    GLTexture redTexture;
+    glActiveTexture(GL_TEXTURE0);
+    initTexture(redTexture, GLColor::red);
+    GLTexture blueTexture;
+    glActiveTexture(GL_TEXTURE1);
+    initTexture(blueTexture, GLColor::blue);
+
+    glUseProgram(singleTextureProgram);
+    glUniform1i(glGetUniformLocation(singleTextureProgram, "tex"), 1);
+    glUseProgram(twoTexturesProgram);
+    glUniform1i(glGetUniformLocation(twoTexturesProgram, "texA"), 0);
+    glUniform1i(glGetUniformLocation(twoTexturesProgram, "texB"), 1);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Left: red + blue.  Right: blue, then red + blue, then blue again.
+    scissorHalf(false);
+    drawQuad(twoTexturesProgram, essl31_shaders::PositionAttrib(), 0.5);
+    scissorHalf(true);
+    drawQuad(singleTextureProgram, essl31_shaders::PositionAttrib(), 0.5);
+    drawQuad(twoTexturesProgram, essl31_shaders::PositionAttrib(), 0.5);
+    drawQuad(singleTextureProgram, essl31_shaders::PositionAttrib(), 0.5);
+    ASSERT_GL_NO_ERROR();
+
+    expectHalves(GLColor::magenta, GLColor::blue);
+}
+
+// Test that the textures of a program are still bound after a UtilsVk draw in the same render
+// pass.  A masked clear is done with a draw inside the render pass, which binds its own pipeline
+// layout.
+TEST_P(PushTextureDescriptorsTest, UtilsDrawInRenderPass)
+{
+    ANGLE_GL_PROGRAM(program, essl31_shaders::vs::Simple(), kSingleTextureFS);
+
+    GLTexture redTexture;
+    glActiveTexture(GL_TEXTURE0);
+    initTexture(redTexture, GLColor::red);
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "tex"), 0);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    scissorHalf(false);
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5);
+
+    // Masked clear of the whole window to green.
+    glDisable(GL_SCISSOR_TEST);
+    glColorMask(GL_FALSE, GL_TRUE, GL_FALSE, GL_FALSE);
+    glClearColor(0, 1, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+    // Draw again without touching the textures.
+    scissorHalf(true);
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5);
+    ASSERT_GL_NO_ERROR();
+
+    expectHalves(GLColor::yellow, GLColor::red);
+}
+
+// Test texture arrays in compute, changing a texture between dispatches and drawing with another
+// program in between.
+TEST_P(PushTextureDescriptorsTest, Compute)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x = 1) in;
+uniform highp sampler2D tex[2];
+layout(std430, binding = 0) buffer Output
+{
+    vec4 colors[2];
+};
+void main()
+{
+    colors[0] = texelFetch(tex[0], ivec2(0), 0);
+    colors[1] = texelFetch(tex[1], ivec2(0), 0);
+})";
+
+    ANGLE_GL_COMPUTE_PROGRAM(computeProgram, kCS);
+    ANGLE_GL_PROGRAM(drawProgram, essl31_shaders::vs::Simple(), kSingleTextureFS);
+
+    GLTexture redTexture;
+    glActiveTexture(GL_TEXTURE0);
+    initTexture(redTexture, GLColor::red);
+    GLTexture greenTexture;
+    glActiveTexture(GL_TEXTURE1);
+    initTexture(greenTexture, GLColor::green);
+    GLTexture blueTexture;
+    glActiveTexture(GL_TEXTURE2);
+    initTexture(blueTexture, GLColor::blue);
+
+    glUseProgram(computeProgram);
+    const GLint kUnits[2] = {0, 1};
+    glUniform1iv(glGetUniformLocation(computeProgram, "tex"), 2, kUnits);
+    glUseProgram(drawProgram);
+    glUniform1i(glGetUniformLocation(drawProgram, "tex"), 2);
+
+    constexpr GLsizeiptr kOutputSize = sizeof(float) * 4 * 2;
+    GLBuffer outputs[2];
+    for (GLBuffer &output : outputs)
+    {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, output);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, kOutputSize, nullptr, GL_STATIC_READ);
+    }
+
+    glUseProgram(computeProgram);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, outputs[0]);
+    glDispatchCompute(1, 1, 1);
+
+    drawQuad(drawProgram, essl31_shaders::PositionAttrib(), 0.5);
+
+    // Replace the green texture of the second element with blue.
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, blueTexture);
+
+    glUseProgram(computeProgram);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, outputs[1]);
+    glDispatchCompute(1, 1, 1);
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, kWindowSize, kWindowSize, GLColor::blue);
+
+    const float kExpected[2][8] = {{1, 0, 0, 1, 0, 1, 0, 1}, {1, 0, 0, 1, 0, 0, 1, 1}};
+    for (int outputIndex = 0; outputIndex < 2; ++outputIndex)
+    {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, outputs[outputIndex]);
+        const float *colors = static_cast<const float *>(
+            glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, kOutputSize, GL_MAP_READ_BIT));
+        ASSERT_NE(nullptr, colors);
+        for (int component = 0; component < 8; ++component)
+        {
+            EXPECT_EQ(kExpected[outputIndex][component], colors[component])
+                << "output " << outputIndex << " component " << component;
+        }
+        glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+}  // anonymous namespace
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PushTextureDescriptorsTest);
+ANGLE_INSTANTIATE_TEST(PushTextureDescriptorsTest,
+                       ES31_VULKAN(),
+                       ES31_VULKAN().enable(Feature::PushTextureDescriptors),
+                       ES31_VULKAN_SWIFTSHADER().enable(Feature::PushTextureDescriptors));
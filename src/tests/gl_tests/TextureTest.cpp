@@ -15881,6 +15881,61 @@ void main()
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
 }
 
+// Test that every element of a samplerBuffer array samples its own buffer.
+// Covers a bug where the Vulkan backend wrote only the last texel buffer view of the array.
+TEST_P(TextureBufferTestES31, SamplerBufferArray)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_OES_texture_buffer"));
+
+    // TODO(http://anglebug.com/42264369): Claims to support GL_OES_texture_buffer, but fails
+    // compilation of shader because "extension 'GL_OES_texture_buffer' is not supported".
+    ANGLE_SKIP_TEST_IF(IsQualcomm() && IsOpenGLES());
+
+    const std::array<GLColor, 1> kRedData  = {GLColor::red};
+    const std::array<GLColor, 1> kBlueData = {GLColor::blue};
+
+    GLBuffer redBuffer;
+    glBindBuffer(GL_TEXTURE_BUFFER, redBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(kRedData), kRedData.data(), GL_STATIC_DRAW);
+
+    GLBuffer blueBuffer;
+    glBindBuffer(GL_TEXTURE_BUFFER, blueBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(kBlueData), kBlueData.data(), GL_STATIC_DRAW);
+
+    GLTexture redTexture;
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, redTexture);
+    glTexBufferOES(GL_TEXTURE_BUFFER, GL_RGBA8, redBuffer);
+
+    GLTexture blueTexture;
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_BUFFER, blueTexture);
+    glTexBufferOES(GL_TEXTURE_BUFFER, GL_RGBA8, blueBuffer);
+    EXPECT_GL_NO_ERROR();
+
+    constexpr char kSamplerBufferArray[] = R"(#version 310 es
+#extension GL_OES_texture_buffer : require
+precision mediump float;
+uniform highp samplerBuffer s[2];
+out vec4 colorOut;
+void main()
+{
+    colorOut = vec4(texelFetch(s[0], 0).r, 0, texelFetch(s[1], 0).b, 1);
+})";
+
+    ANGLE_GL_PROGRAM(program, essl31_shaders::vs::Simple(), kSamplerBufferArray);
+    glUseProgram(program);
+
+    const GLint samplerLoc = glGetUniformLocation(program, "s");
+    ASSERT_NE(-1, samplerLoc);
+    const GLint kUnits[2] = {0, 1};
+    glUniform1iv(samplerLoc, 2, kUnits);
+
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::magenta);
+}
+
 // Test that glTexBufferEXT can be used in a draw call for R8 normalized values.
 TEST_P(TextureBufferTestES31, RNorm8EXT)
 {
@@ -17975,7 +18030,8 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(ETC1CompressedTextureTest);
 ANGLE_INSTANTIATE_TEST_ES3(PBOCompressedTexture3DTest);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TextureBufferTestES31);
-ANGLE_INSTANTIATE_TEST_ES31(TextureBufferTestES31);
+ANGLE_INSTANTIATE_TEST_ES31_AND(TextureBufferTestES31,
+                                ES31_VULKAN().enable(Feature::PushTextureDescriptors));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TextureBufferTestES32);
 ANGLE_INSTANTIATE_TEST_ES32(TextureBufferTestES32);
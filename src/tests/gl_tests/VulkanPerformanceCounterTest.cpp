@@ -465,6 +465,12 @@ class VulkanPerformanceCounterTest_Prerotation : public VulkanPerformanceCounter
     }
 };
 
+class VulkanPerformanceCounterTest_MergeRenderPasses : public VulkanPerformanceCounterTest
+{};
+
+class VulkanPerformanceCounterTest_ScissoredClearLoadOp : public VulkanPerformanceCounterTest
+{};
+
 void VulkanPerformanceCounterTest::maskedFramebufferFetchDraw(const GLColor &clearColor,
                                                               GLBuffer &buffer)
 {
@@ -2621,6 +2627,49 @@ TEST_P(VulkanPerformanceCounterTest, ColorClearMaskedDrawThenClear)
                                      getPerfCounters().colorClearAttachments);
 }
 
+// Tests that a masked color clear after a clear is folded into the deferred clear.
+//
+// - Scenario: clear, mask color, clear, draw
+TEST_P(VulkanPerformanceCounterTest, ColorClearThenMaskedClear)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    angle::VulkanPerfCounters expected;
+
+    // Expect rpCount+1, color(Clears+1, Loads+0, LoadNones+0, Stores+1, StoreNones+0)
+    // No vkCmdClearAttachments should be issued.
+    setExpectedCountersForColorOps(getPerfCounters(), 1, 1, 0, 0, 1, 0, &expected);
+    expected.colorClearAttachments = getPerfCounters().colorClearAttachments;
+
+    GLFramebuffer framebuffer;
+    GLTexture texture;
+    setupForColorOpsTest(&framebuffer, &texture);
+
+    // Clear color first
+    glClearColor(1, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Then clear only the green channel.  This clear is merged with the previous one.
+    glColorMask(GL_FALSE, GL_TRUE, GL_FALSE, GL_FALSE);
+    glClearColor(0, 1, 1, 0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Draw to the center of the framebuffer, which uses the cleared values as loadOp.
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Blue());
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f, 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expected.renderPasses, getPerfCounters().renderPasses);
+
+    // Break the render pass and check how many loads and stores were actually done
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
+    EXPECT_PIXEL_COLOR_EQ(kOpsTestSize / 2, kOpsTestSize / 2, GLColor::blue);
+    EXPECT_COLOR_OP_COUNTERS(getPerfCounters(), expected);
+    EXPECT_CLEAR_ATTACHMENTS_COUNTER(expected.colorClearAttachments,
+                                     getPerfCounters().colorClearAttachments);
+}
+
 // Test that clear of read-only color is not reordered with the draw.
 //
 // - Scenario: mask color, framebuffer fetch draw, clear
@@ -7362,6 +7411,119 @@ TEST_P(VulkanPerformanceCounterTest, VerifySubmitCountersForSwapBuffer)
     EXPECT_EQ(getPerfCounters().commandQueueSubmitCallsTotal, expectedCommandQueueSubmitCount);
 }
 
+// Tests that switching between framebuffers with identical attachments does not break the render
+// pass.
+TEST_P(VulkanPerformanceCounterTest_MergeRenderPasses, SwitchFramebuffersWithIdenticalAttachments)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(!isFeatureEnabled(Feature::MergeRenderPassesAcrossFramebuffers));
+
+    constexpr GLsizei kSize = 16;
+
+    GLTexture color;
+    glBindTexture(GL_TEXTURE_2D, color);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+
+    GLRenderbuffer depthStencil;
+    glBindRenderbuffer(GL_RENDERBUFFER, depthStencil);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, kSize, kSize);
+
+    GLFramebuffer framebuffers[2];
+    for (GLFramebuffer &framebuffer : framebuffers)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+                                  depthStencil);
+        ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    }
+
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    uint64_t expectedRenderPassCount = getPerfCounters().renderPasses + 1;
+    uint64_t expectedMergedRenderPassCount =
+        getPerfCounters().renderPassesMergedAcrossFramebuffers + 1;
+
+    // Start the render pass with the first framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[0]);
+    glClearColor(0, 0, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+
+    // Continue it with the second framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[1]);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f, 0.5f);
+
+    // And with the first framebuffer again.
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[0]);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f, 0.25f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(getPerfCounters().renderPasses, expectedRenderPassCount);
+    EXPECT_EQ(getPerfCounters().renderPassesMergedAcrossFramebuffers,
+              expectedMergedRenderPassCount);
+
+    // Verify rendering results.
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 2, GLColor::green);
+}
+
+// Tests that a scissored clear that starts a render pass uses loadOp=Clear, and that growing the
+// render area after drawing starts a new render pass without clearing outside the scissor.
+TEST_P(VulkanPerformanceCounterTest_ScissoredClearLoadOp, ScissoredClearThenDrawOutsideScissor)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(!isFeatureEnabled(Feature::ClearScissoredAttachmentsWithLoadOp));
+    ANGLE_SKIP_TEST_IF(hasPreferDrawOverClearAttachments());
+
+    GLFramebuffer framebuffer;
+    GLTexture texture;
+    setupForColorOpsTest(&framebuffer, &texture);
+
+    // Initialize the framebuffer in a separate render pass.
+    glClearColor(0, 0, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    angle::VulkanPerfCounters expected;
+
+    // Expect rpCount+2, color(Clears+1, Loads+1, LoadNones+0, Stores+2, StoreNones+0)
+    // No vkCmdClearAttachments should be issued.
+    setExpectedCountersForColorOps(getPerfCounters(), 2, 1, 1, 0, 2, 0, &expected);
+    expected.colorClearAttachments = getPerfCounters().colorClearAttachments;
+
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    ANGLE_GL_PROGRAM(yellowProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(yellowProgram);
+    glUniform4f(glGetUniformLocation(yellowProgram, essl1_shaders::ColorUniform()), 1, 1, 0, 1);
+
+    // Clear the bottom-left quarter, and draw inside it.
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, kOpsTestSize / 2, kOpsTestSize / 2);
+    glClearColor(1, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f, 0.5f);
+
+    // Draw outside the scissor.  The render area cannot grow without the loadOp=Clear clearing
+    // outside the scissor, so a new render pass is started.
+    glDisable(GL_SCISSOR_TEST);
+    drawQuad(yellowProgram, essl1_shaders::PositionAttrib(), 0.5f, 0.25f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kOpsTestSize * 5 / 16, kOpsTestSize * 5 / 16, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kOpsTestSize / 2, kOpsTestSize / 2, GLColor::yellow);
+    EXPECT_PIXEL_COLOR_EQ(kOpsTestSize - 1, kOpsTestSize - 1, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kOpsTestSize - 1, 0, GLColor::blue);
+
+    EXPECT_EQ(expected.renderPasses, getPerfCounters().renderPasses);
+    EXPECT_COLOR_OP_COUNTERS(getPerfCounters(), expected);
+    EXPECT_CLEAR_ATTACHMENTS_COUNTER(expected.colorClearAttachments,
+                                     getPerfCounters().colorClearAttachments);
+}
+
 // Tests that PreferSubmitAtFBOBoundary feature works properly. Bind to different FBO and should
 // trigger submit of previous FBO. In this specific test, we switch to system default framebuffer
 // which is always considered as "dirty".
@@ -8570,6 +8732,18 @@ ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_Prerotation,
                        ES3_VULKAN().enable(Feature::EmulatedPrerotation180),
                        ES3_VULKAN().enable(Feature::EmulatedPrerotation270));
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_MergeRenderPasses);
+ANGLE_INSTANTIATE_TEST(
+    VulkanPerformanceCounterTest_MergeRenderPasses,
+    ES3_VULKAN().enable(Feature::MergeRenderPassesAcrossFramebuffers),
+    ES3_VULKAN_SWIFTSHADER().enable(Feature::MergeRenderPassesAcrossFramebuffers));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_ScissoredClearLoadOp);
+ANGLE_INSTANTIATE_TEST(
+    VulkanPerformanceCounterTest_ScissoredClearLoadOp,
+    ES3_VULKAN().enable(Feature::ClearScissoredAttachmentsWithLoadOp),
+    ES3_VULKAN_SWIFTSHADER().enable(Feature::ClearScissoredAttachmentsWithLoadOp));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_SingleBuffer);
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_SingleBuffer, ES3_VULKAN());
 
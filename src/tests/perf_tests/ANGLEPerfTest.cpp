@@ -329,6 +329,22 @@ ANGLEPerfTest::ANGLEPerfTest(const std::string &name,
     mReporter->RegisterFyiMetric(".trial_steps", "count");
     mReporter->RegisterFyiMetric(".total_steps", "count");
 
+    if (gCPUCacheCounters)
+    {
+        if (mCPUCacheCounters.initialize())
+        {
+            mReporter->RegisterFyiMetric(".cache_references", "count");
+            mReporter->RegisterFyiMetric(".cache_misses", "count");
+            mReporter->RegisterFyiMetric(".l1d_read_misses", "count");
+        }
+        else
+        {
+            fprintf(stderr,
+                    "Could not open the CPU cache counters, check "
+                    "/proc/sys/kernel/perf_event_paranoid.\n");
+        }
+    }
+
     if (kHasATrace)
     {
         SetupATrace();
@@ -418,6 +434,10 @@ void ANGLEPerfTest::runTrial(double maxRunTime, int maxStepsToRun, RunTrialPolic
     mGPUTimeNs              = 0;
     int stepAlignment       = getStepAlignment();
     mTrialTimer.start();
+    if (mCPUCacheCounters.isInitialized())
+    {
+        mCPUCacheCounters.start();
+    }
     startTest();
 
     int loopStepsPerformed  = 0;
@@ -506,6 +526,10 @@ void ANGLEPerfTest::runTrial(double maxRunTime, int maxStepsToRun, RunTrialPolic
         atraceCounter("TraceLoopFrameTimeAvgUs", 0);
     }
     finishTest();
+    if (mCPUCacheCounters.isInitialized())
+    {
+        mCPUCacheCounters.stop();
+    }
     mTrialTimer.stop();
     computeGPUTime();
 }
@@ -600,6 +624,16 @@ void ANGLEPerfTest::processResults()
     mReporter->AddResult(".trial_steps", static_cast<size_t>(mTrialNumStepsPerformed));
     mReporter->AddResult(".total_steps", static_cast<size_t>(mTotalNumStepsPerformed));
 
+    if (mCPUCacheCounters.isInitialized())
+    {
+        processCPUCacheCounterResult(
+            ".cache_references", mCPUCacheCounters.getValue(CPUCacheCounter::References));
+        processCPUCacheCounterResult(".cache_misses",
+                                     mCPUCacheCounters.getValue(CPUCacheCounter::Misses));
+        processCPUCacheCounterResult(
+            ".l1d_read_misses", mCPUCacheCounters.getValue(CPUCacheCounter::L1DataReadMisses));
+    }
+
     if (!mProcessMemoryUsageKBSamples.empty())
     {
         std::sort(mProcessMemoryUsageKBSamples.begin(), mProcessMemoryUsageKBSamples.end());
@@ -686,6 +720,16 @@ void ANGLEPerfTest::processClockResult(const char *metric, double resultSeconds)
                        "msBestFitFormat_smallerIsBetter");
 }
 
+void ANGLEPerfTest::processCPUCacheCounterResult(const char *metric, uint64_t count)
+{
+    // Like the clock results, report the count per iteration.
+    double countPerStep      = static_cast<double>(count) / mTrialNumStepsPerformed;
+    double countPerIteration = countPerStep / mIterationsPerStep;
+
+    recordDoubleMetric(metric, countPerIteration, "count");
+    addHistogramSample(metric, countPerIteration, "count");
+}
+
 void ANGLEPerfTest::processMemoryResult(const char *metric, uint64_t resultKB)
 {
     perf_test::MetricInfo metricInfo;
@@ -18,6 +18,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "CPUCacheCounters.h"
 #include "platform/PlatformMethods.h"
 #include "test_utils/angle_test_configs.h"
 #include "test_utils/angle_test_instantiate.h"
@@ -118,6 +119,7 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     void processResults();
     void processClockResult(const char *metric, double resultSeconds);
     void processMemoryResult(const char *metric, uint64_t resultKB);
+    void processCPUCacheCounterResult(const char *metric, uint64_t count);
 
     void skipTest(const std::string &reason)
     {
@@ -156,6 +158,9 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     std::map<GLuint, CounterInfo> mPerfCounterInfo;
     GLuint mPerfMonitor;
     std::vector<uint64_t> mProcessMemoryUsageKBSamples;
+
+    // Enabled with --cpu-cache-counters, counts the cache misses of the test thread in each trial.
+    CPUCacheCounters mCPUCacheCounters;
 };
 
 enum class SurfaceType
@@ -42,6 +42,7 @@ bool gRetraceMode                  = false;
 bool gMinimizeGPUWork              = false;
 bool gTraceTestValidation          = false;
 const char *gPerfCounters          = nullptr;
+bool gCPUCacheCounters             = false;
 const char *gUseANGLE              = nullptr;
 const char *gUseGL                 = nullptr;
 bool gOffscreen                    = false;
@@ -54,6 +55,7 @@ const char *gTraceInterpreter      = nullptr;
 const char *gPrintExtensionsToFile = nullptr;
 const char *gRequestedExtensions   = nullptr;
 bool gIncludeInactiveResources     = false;
+const char *gShaderCorpusDir       = nullptr;
 
 namespace
 {
@@ -66,8 +68,10 @@ bool PerfTestArg(int *argc, char **argv, int argIndex)
            ParseFlag("--verbose-logging", argc, argv, argIndex, &gVerboseLogging) ||
            ParseFlag("--no-finish", argc, argv, argIndex, &gNoFinish) ||
            ParseFlag("--warmup", argc, argv, argIndex, &gWarmup) ||
+           ParseFlag("--cpu-cache-counters", argc, argv, argIndex, &gCPUCacheCounters) ||
            ParseCStringArg("--trace-file", argc, argv, argIndex, &gTraceFile) ||
            ParseCStringArg("--perf-counters", argc, argv, argIndex, &gPerfCounters) ||
+           ParseCStringArg("--shader-corpus-dir", argc, argv, argIndex, &gShaderCorpusDir) ||
            ParseIntArg("--steps-per-trial", argc, argv, argIndex, &gStepsPerTrial) ||
            ParseIntArg("--max-steps-performed", argc, argv, argIndex, &gMaxStepsPerformed) ||
            ParseIntArg("--fixed-test-time", argc, argv, argIndex, &gFixedTestTime) ||
@@ -34,6 +34,7 @@ extern bool gMinimizeGPUWork;
 extern bool gTraceTestValidation;
 extern const char *gTraceInterpreter;
 extern const char *gPerfCounters;
+extern bool gCPUCacheCounters;
 extern const char *gUseANGLE;
 extern const char *gUseGL;
 extern bool gOffscreen;
@@ -42,6 +43,7 @@ extern int gFpsLimit;
 extern const char *gPrintExtensionsToFile;
 extern const char *gRequestedExtensions;
 extern bool gIncludeInactiveResources;
+extern const char *gShaderCorpusDir;
 
 // Constant for when trace's frame count should be used
 constexpr int kAllFrames = -1;
@@ -0,0 +1,138 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CPUCacheCounters.cpp:
+//   Counts the CPU cache misses of the calling thread with perf_event on Linux.
+//
+
+#include "CPUCacheCounters.h"
+
+#include "common/debug.h"
+#include "common/platform.h"
+
+#if defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    define ANGLE_HAS_PERF_EVENT 1
+#else
+#    define ANGLE_HAS_PERF_EVENT 0
+#endif
+
+namespace
+{
+constexpr int kInvalidFd = -1;
+
+#if ANGLE_HAS_PERF_EVENT
+int OpenCounter(uint32_t type, uint64_t config)
+{
+    perf_event_attr attr = {};
+    attr.size            = sizeof(attr);
+    attr.type            = type;
+    attr.config          = config;
+    attr.disabled        = 1;
+    attr.exclude_kernel  = 1;
+    attr.exclude_hv      = 1;
+
+    // Count the calling thread on any CPU.
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+uint64_t GetCounterConfig(CPUCacheCounter counter)
+{
+    switch (counter)
+    {
+        case CPUCacheCounter::References:
+            return PERF_COUNT_HW_CACHE_REFERENCES;
+        case CPUCacheCounter::Misses:
+            return PERF_COUNT_HW_CACHE_MISSES;
+        case CPUCacheCounter::L1DataReadMisses:
+            return PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                   (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+uint32_t GetCounterType(CPUCacheCounter counter)
+{
+    return counter == CPUCacheCounter::L1DataReadMisses ? PERF_TYPE_HW_CACHE : PERF_TYPE_HARDWARE;
+}
+#endif  // ANGLE_HAS_PERF_EVENT
+}  // anonymous namespace
+
+CPUCacheCounters::CPUCacheCounters() : mInitialized(false)
+{
+    mFds.fill(kInvalidFd);
+    mValues.fill(0);
+}
+
+CPUCacheCounters::~CPUCacheCounters()
+{
+#if ANGLE_HAS_PERF_EVENT
+    for (int fd : mFds)
+    {
+        if (fd != kInvalidFd)
+        {
+            close(fd);
+        }
+    }
+#endif  // ANGLE_HAS_PERF_EVENT
+}
+
+bool CPUCacheCounters::initialize()
+{
+    ASSERT(!mInitialized);
+
+#if ANGLE_HAS_PERF_EVENT
+    for (CPUCacheCounter counter : angle::AllEnums<CPUCacheCounter>())
+    {
+        mFds[counter] = OpenCounter(GetCounterType(counter), GetCounterConfig(counter));
+        if (mFds[counter] == kInvalidFd)
+        {
+            return false;
+        }
+    }
+
+    mInitialized = true;
+#endif  // ANGLE_HAS_PERF_EVENT
+
+    return mInitialized;
+}
+
+void CPUCacheCounters::start()
+{
+    ASSERT(mInitialized);
+
+#if ANGLE_HAS_PERF_EVENT
+    for (int fd : mFds)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif  // ANGLE_HAS_PERF_EVENT
+}
+
+void CPUCacheCounters::stop()
+{
+    ASSERT(mInitialized);
+
+#if ANGLE_HAS_PERF_EVENT
+    for (CPUCacheCounter counter : angle::AllEnums<CPUCacheCounter>())
+    {
+        int fd = mFds[counter];
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+        uint64_t value = 0;
+        if (read(fd, &value, sizeof(value)) != sizeof(value))
+        {
+            value = 0;
+        }
+        mValues[counter] = value;
+    }
+#endif  // ANGLE_HAS_PERF_EVENT
+}
@@ -0,0 +1,54 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CPUCacheCounters.h:
+//   Counts the CPU cache misses of the calling thread with perf_event on Linux.  Used by
+//   angle_perftests to measure how memory-bound the per-call CPU overhead is.
+//
+
+#ifndef TESTS_PERF_TESTS_CPU_CACHE_COUNTERS_H_
+#define TESTS_PERF_TESTS_CPU_CACHE_COUNTERS_H_
+
+#include <cstdint>
+
+#include "common/PackedEnums.h"
+#include "common/angleutils.h"
+
+enum class CPUCacheCounter
+{
+    // Accesses to the last level cache, and the misses among them.
+    References,
+    Misses,
+    // Read misses in the L1 data cache.
+    L1DataReadMisses,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+class CPUCacheCounters final : angle::NonCopyable
+{
+  public:
+    CPUCacheCounters();
+    ~CPUCacheCounters();
+
+    // Opens the counters.  Fails on platforms other than Linux, and if the kernel doesn't allow
+    // unprivileged counting (see /proc/sys/kernel/perf_event_paranoid).
+    bool initialize();
+    bool isInitialized() const { return mInitialized; }
+
+    // Counts the events of the calling thread between start() and stop().  Only events in user
+    // space are counted, and each start() resets the values.
+    void start();
+    void stop();
+    uint64_t getValue(CPUCacheCounter counter) const { return mValues[counter]; }
+
+  private:
+    bool mInitialized;
+    angle::PackedEnumMap<CPUCacheCounter, int> mFds;
+    angle::PackedEnumMap<CPUCacheCounter, uint64_t> mValues;
+};
+
+#endif  // TESTS_PERF_TESTS_CPU_CACHE_COUNTERS_H_
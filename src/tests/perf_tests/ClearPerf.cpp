@@ -35,7 +35,9 @@ struct ClearParams final : public RenderTestParams
 
         internalFormat = GL_RGBA8;
 
-        scissoredClear = false;
+        scissoredClear         = false;
+        scissoredClearThenDraw = false;
+        maskedClear            = false;
     }
 
     std::string story() const override;
@@ -46,6 +48,8 @@ struct ClearParams final : public RenderTestParams
     GLenum internalFormat;
 
     bool scissoredClear;
+    bool scissoredClearThenDraw;
+    bool maskedClear;
 };
 
 std::ostream &operator<<(std::ostream &os, const ClearParams &params)
@@ -70,6 +74,16 @@ std::string ClearParams::story() const
         strstr << "_scissoredClear";
     }
 
+    if (scissoredClearThenDraw)
+    {
+        strstr << "_scissoredClearThenDraw";
+    }
+
+    if (maskedClear)
+    {
+        strstr << "_maskedClear";
+    }
+
     return strstr.str();
 }
 
@@ -151,6 +165,17 @@ void ClearBenchmark::drawBenchmark()
     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRbo);
     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRbo);
 
+    // A second framebuffer with the same attachments, used to break the render pass between
+    // scissored clears.
+    GLFramebuffer otherFbo;
+    if (params.scissoredClearThenDraw)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, otherFbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    }
+
     glViewport(0, 0, params.fboSize, params.fboSize);
     glDisable(GL_SCISSOR_TEST);
 
@@ -176,6 +201,40 @@ void ClearBenchmark::drawBenchmark()
             glClear(GL_COLOR_BUFFER_BIT);
         }
     }
+    else if (params.scissoredClearThenDraw)
+    {
+        // Every clear starts a render pass with a small render area, as is common when parts of a
+        // UI are updated.
+        const GLsizei regionSize = params.fboSize / 4;
+        glEnable(GL_SCISSOR_TEST);
+        for (size_t it = 0; it < params.iterationsPerStep; ++it)
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, it % 2 == 0 ? fbo : otherFbo);
+            glScissor(static_cast<GLint>(it % 4) * regionSize, 0, regionSize, regionSize);
+
+            float clearValue = (it % 2) * 0.5f + 0.2f;
+            glClearColor(clearValue, clearValue, clearValue, clearValue);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+    }
+    else if (params.maskedClear)
+    {
+        for (size_t it = 0; it < params.iterationsPerStep; ++it)
+        {
+            float clearValue = (it % 2) * 0.5f + 0.2f;
+            glClearColor(clearValue, clearValue, clearValue, clearValue);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            // Follow up with a masked clear of a subset of the channels.
+            glColorMask(GL_TRUE, GL_FALSE, GL_TRUE, GL_FALSE);
+            glClearColor(1.0f - clearValue, 0, 1.0f - clearValue, 0);
+            glClear(GL_COLOR_BUFFER_BIT);
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+    }
     else
     {
         for (size_t it = 0; it < params.iterationsPerStep; ++it)
@@ -225,6 +284,23 @@ ClearParams VulkanParams(bool emulatedFormat, bool scissoredClear)
     return params;
 }
 
+ClearParams VulkanScissoredClearThenDrawParams()
+{
+    ClearParams params;
+    params.eglParameters =
+        egl_platform::VULKAN().enable(Feature::ClearScissoredAttachmentsWithLoadOp);
+    params.scissoredClearThenDraw = true;
+    return params;
+}
+
+ClearParams VulkanMaskedClearParams()
+{
+    ClearParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.maskedClear   = true;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(ClearBenchmark, Run)
@@ -238,4 +314,6 @@ ANGLE_INSTANTIATE_TEST(ClearBenchmark,
                        OpenGLOrGLESParams(),
                        VulkanParams(false, false),
                        VulkanParams(true, false),
-                       VulkanParams(false, true));
+                       VulkanParams(false, true),
+                       VulkanScissoredClearThenDrawParams(),
+                       VulkanMaskedClearParams());
@@ -0,0 +1,409 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilerCorpusPerfTest:
+//   Performance test for the shader translator driven by a corpus of shaders on disk.  Every step
+//   compiles each shader found in --shader-corpus-dir once with the output under test.  Besides
+//   the overall time, the test reports the average cost of each translator phase and the peak pool
+//   allocator usage over all compilations.
+//
+
+#include "ANGLEPerfTest.h"
+#include "ANGLEPerfTestArgs.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/string_utils.h"
+#include "common/system_utils.h"
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+#include "compiler/translator/Compiler.h"
+#include "compiler/translator/InitializeGlobals.h"
+#include "compiler/translator/PoolAlloc.h"
+
+namespace
+{
+constexpr double kMilliSecondsPerSecond = 1e3;
+constexpr double kMicroSecondsPerSecond = 1e6;
+
+constexpr char kPreprocessTimeMetric[] = ".preprocess_time";
+constexpr char kParseTimeMetric[]      = ".parse_time";
+constexpr char kASTPassesTimeMetric[]  = ".ast_passes_time";
+constexpr char kCodeGenTimeMetric[]    = ".codegen_time";
+constexpr char kPeakPoolMemoryMetric[] = ".peak_pool_memory";
+constexpr char kFailedShadersMetric[]  = ".failed_shaders";
+
+struct CorpusShader
+{
+    std::string name;
+    GLenum shaderType;
+    std::string source;
+};
+
+GLenum GetShaderTypeFromExtension(const std::string &extension)
+{
+    if (extension == ".vert")
+    {
+        return GL_VERTEX_SHADER;
+    }
+    if (extension == ".frag")
+    {
+        return GL_FRAGMENT_SHADER;
+    }
+    if (extension == ".comp")
+    {
+        return GL_COMPUTE_SHADER;
+    }
+    if (extension == ".geom")
+    {
+        return GL_GEOMETRY_SHADER_EXT;
+    }
+    if (extension == ".tesc")
+    {
+        return GL_TESS_CONTROL_SHADER_EXT;
+    }
+    if (extension == ".tese")
+    {
+        return GL_TESS_EVALUATION_SHADER_EXT;
+    }
+    return GL_NONE;
+}
+
+// Loads every shader in |directory| (non-recursively), sorted by file name so that the compile order
+// is stable from run to run.
+std::vector<CorpusShader> LoadShaderCorpus(const char *directory)
+{
+    std::vector<CorpusShader> corpus;
+    if (directory == nullptr || !angle::IsDirectory(directory))
+    {
+        return corpus;
+    }
+
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(directory, error))
+    {
+        if (!entry.is_regular_file())
+        {
+            continue;
+        }
+
+        const std::filesystem::path &path = entry.path();
+        GLenum shaderType = GetShaderTypeFromExtension(path.extension().string());
+        if (shaderType == GL_NONE)
+        {
+            continue;
+        }
+
+        CorpusShader shader;
+        shader.name       = path.filename().string();
+        shader.shaderType = shaderType;
+        if (angle::ReadFileToString(path.string(), &shader.source))
+        {
+            corpus.push_back(std::move(shader));
+        }
+    }
+
+    std::sort(corpus.begin(), corpus.end(),
+              [](const CorpusShader &a, const CorpusShader &b) { return a.name < b.name; });
+    return corpus;
+}
+
+// Discards everything the preprocessor reports; only the cost of tokenizing and expanding macros is
+// of interest.
+class NullPreprocessorDiagnostics : public angle::pp::Diagnostics
+{
+  protected:
+    void print(ID id, const angle::pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public angle::pp::DirectiveHandler
+{
+  public:
+    void handleError(const angle::pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const angle::pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {}
+    void handleExtension(const angle::pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {}
+    void handleVersion(const angle::pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       angle::pp::MacroSet *macro_set) override
+    {}
+};
+
+struct CompilerCorpusPerfParameters
+{
+    CompilerCorpusPerfParameters(ShShaderOutput output) : output(output) {}
+
+    const char *str() const
+    {
+        switch (output)
+        {
+            case SH_SPIRV_VULKAN_OUTPUT:
+                return "SPIRV";
+            case SH_GLSL_450_CORE_OUTPUT:
+                return "GLSL_4_50";
+            case SH_ESSL_OUTPUT:
+                return "ESSL";
+            case SH_WGSL_OUTPUT:
+                return "WGSL";
+            default:
+                UNREACHABLE();
+                return "unk";
+        }
+    }
+
+    ShShaderOutput output;
+};
+
+// Outputs that are not compiled into this build are filtered out of the test list.
+bool IsPlatformAvailable(const CompilerCorpusPerfParameters &param)
+{
+    angle::PoolAllocator allocator;
+    InitializePoolIndex();
+    allocator.push();
+    SetGlobalPoolAllocator(&allocator);
+    ShHandle translator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_2_SPEC, param.output);
+    bool success        = translator != nullptr;
+    sh::Destruct(translator);
+    SetGlobalPoolAllocator(nullptr);
+    allocator.pop();
+    FreePoolIndex();
+    return success;
+}
+
+std::ostream &operator<<(std::ostream &stream, const CompilerCorpusPerfParameters &p)
+{
+    stream << p.str();
+    return stream;
+}
+
+class CompilerCorpusPerfTest : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<CompilerCorpusPerfParameters>
+{
+  public:
+    CompilerCorpusPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    double preprocess(const CorpusShader &shader);
+    void recordPhaseMetric(const char *metric, double totalSeconds);
+
+    std::vector<CorpusShader> mCorpus;
+
+    angle::PoolAllocator mAllocator;
+    bool mPoolInitialized;
+    std::map<GLenum, sh::TCompiler *> mTranslators;
+
+    // Accumulated over every compilation performed by the test.
+    size_t mCompileCount;
+    size_t mFailedCompileCount;
+    double mPreprocessTimeSeconds;
+    double mParseTimeSeconds;
+    double mASTPassesTimeSeconds;
+    double mCodeGenTimeSeconds;
+    size_t mPeakPoolBytes;
+};
+
+CompilerCorpusPerfTest::CompilerCorpusPerfTest()
+    : ANGLEPerfTest("CompilerCorpusPerf", "", GetParam().str(), 1),
+      mPoolInitialized(false),
+      mCompileCount(0),
+      mFailedCompileCount(0),
+      mPreprocessTimeSeconds(0),
+      mParseTimeSeconds(0),
+      mASTPassesTimeSeconds(0),
+      mCodeGenTimeSeconds(0),
+      mPeakPoolBytes(0)
+{
+    mCorpus = LoadShaderCorpus(angle::gShaderCorpusDir);
+
+    // Report timings per shader rather than per pass over the corpus.
+    if (!mCorpus.empty())
+    {
+        mIterationsPerStep = static_cast<int>(mCorpus.size());
+    }
+}
+
+void CompilerCorpusPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    if (angle::gShaderCorpusDir == nullptr)
+    {
+        skipTest("No shader corpus specified, use --shader-corpus-dir");
+        return;
+    }
+    if (mCorpus.empty())
+    {
+        skipTest(std::string("No shaders found in ") + angle::gShaderCorpusDir);
+        return;
+    }
+
+    InitializePoolIndex();
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+    mPoolInitialized = true;
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.FragmentPrecisionHigh = true;
+
+    for (const CorpusShader &shader : mCorpus)
+    {
+        if (mTranslators.count(shader.shaderType) > 0)
+        {
+            continue;
+        }
+
+        sh::TCompiler *translator =
+            sh::ConstructCompiler(shader.shaderType, SH_GLES3_2_SPEC, GetParam().output);
+        if (translator == nullptr || !translator->Init(resources))
+        {
+            SafeDelete(translator);
+            failTest(std::string("Failed to initialize translator for ") + shader.name);
+            return;
+        }
+        mTranslators[shader.shaderType] = translator;
+    }
+
+    mReporter->RegisterImportantMetric(kPreprocessTimeMetric, "us");
+    mReporter->RegisterImportantMetric(kParseTimeMetric, "us");
+    mReporter->RegisterImportantMetric(kASTPassesTimeMetric, "us");
+    mReporter->RegisterImportantMetric(kCodeGenTimeMetric, "us");
+    mReporter->RegisterImportantMetric(kPeakPoolMemoryMetric, "sizeInBytes");
+    mReporter->RegisterFyiMetric(kFailedShadersMetric, "count");
+}
+
+void CompilerCorpusPerfTest::TearDown()
+{
+    if (mCompileCount > 0)
+    {
+        recordPhaseMetric(kPreprocessTimeMetric, mPreprocessTimeSeconds);
+        recordPhaseMetric(kParseTimeMetric, mParseTimeSeconds);
+        recordPhaseMetric(kASTPassesTimeMetric, mASTPassesTimeSeconds);
+        recordPhaseMetric(kCodeGenTimeMetric, mCodeGenTimeSeconds);
+
+        recordIntegerMetric(kPeakPoolMemoryMetric, mPeakPoolBytes, "sizeInBytes");
+        addHistogramSample(kPeakPoolMemoryMetric, static_cast<double>(mPeakPoolBytes),
+                           "sizeInBytes_smallerIsBetter");
+
+        // Each failing shader is counted once per step; report the number of distinct shaders.
+        recordIntegerMetric(kFailedShadersMetric,
+                            mFailedCompileCount * mCorpus.size() / mCompileCount, "count");
+    }
+
+    for (auto &translator : mTranslators)
+    {
+        SafeDelete(translator.second);
+    }
+    mTranslators.clear();
+
+    if (mPoolInitialized)
+    {
+        SetGlobalPoolAllocator(nullptr);
+        mAllocator.pop();
+
+        FreePoolIndex();
+        mPoolInitialized = false;
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerCorpusPerfTest::recordPhaseMetric(const char *metric, double totalSeconds)
+{
+    double secondsPerCompile = totalSeconds / static_cast<double>(mCompileCount);
+
+    recordDoubleMetric(metric, secondsPerCompile * kMicroSecondsPerSecond, "us");
+    addHistogramSample(metric, secondsPerCompile * kMilliSecondsPerSecond,
+                       "msBestFitFormat_smallerIsBetter");
+}
+
+// The translator drives the preprocessor from its lexer, so its cost cannot be separated from the
+// parse time of a real compilation.  Run it standalone over the same source to measure it.
+double CompilerCorpusPerfTest::preprocess(const CorpusShader &shader)
+{
+    NullPreprocessorDiagnostics diagnostics;
+    NullDirectiveHandler directiveHandler;
+    angle::pp::Preprocessor preprocessor(&diagnostics, &directiveHandler,
+                                         angle::pp::PreprocessorSettings(SH_GLES3_2_SPEC));
+
+    const char *shaderStrings[] = {shader.source.c_str()};
+
+    double startTime = angle::GetCurrentSystemTime();
+    if (preprocessor.init(1, shaderStrings, nullptr))
+    {
+        angle::pp::Token token;
+        do
+        {
+            preprocessor.lex(&token);
+        } while (token.type != angle::pp::Token::LAST);
+    }
+    return angle::GetCurrentSystemTime() - startTime;
+}
+
+void CompilerCorpusPerfTest::step()
+{
+    ShCompileOptions compileOptions              = {};
+    compileOptions.objectCode                    = true;
+    compileOptions.initializeUninitializedLocals = true;
+    compileOptions.initOutputVariables           = true;
+
+    for (const CorpusShader &shader : mCorpus)
+    {
+        sh::TCompiler *translator   = mTranslators[shader.shaderType];
+        const char *shaderStrings[] = {shader.source.c_str()};
+
+        mPreprocessTimeSeconds += preprocess(shader);
+
+        bool success = translator->compile(shaderStrings, 1, compileOptions);
+
+        const sh::TCompileStatistics &statistics = translator->getCompileStatistics();
+        mParseTimeSeconds += statistics.parseTimeSeconds;
+        mASTPassesTimeSeconds += statistics.astPassesTimeSeconds;
+        mCodeGenTimeSeconds += statistics.codeGenTimeSeconds;
+        mPeakPoolBytes = std::max(mPeakPoolBytes, statistics.peakPoolBytes);
+        ++mCompileCount;
+
+        if (!success)
+        {
+            // Only log the first time through the corpus.
+            if (angle::gVerboseLogging && mCompileCount <= mCorpus.size())
+            {
+                std::cout << "Compiling " << shader.name << " failed with log:\n"
+                          << translator->getInfoSink().info.c_str();
+            }
+            ++mFailedCompileCount;
+        }
+    }
+}
+
+TEST_P(CompilerCorpusPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerCorpusPerfTest,
+                       CompilerCorpusPerfParameters(SH_SPIRV_VULKAN_OUTPUT),
+                       CompilerCorpusPerfParameters(SH_GLSL_450_CORE_OUTPUT),
+                       CompilerCorpusPerfParameters(SH_ESSL_OUTPUT),
+                       CompilerCorpusPerfParameters(SH_WGSL_OUTPUT));
+
+}  // anonymous namespace
@@ -29,6 +29,7 @@ enum class StateChange
     Scissor,
     ManyTextureDraw,
     Uniform,
+    ValidationOnly,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
@@ -44,6 +45,10 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string story() const override;
 
     StateChange stateChange = StateChange::NoChange;
+    // Draw validation has extra buffer access checks in WebGL contexts.
+    bool webgl = false;
+    // Hand the draws and state changes to a worker thread (offloadGlCallsToWorkerThread).
+    bool offloadCalls = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -81,10 +86,23 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Uniform:
             strstr << "_uniform";
             break;
+        case StateChange::ValidationOnly:
+            strstr << "_validation_only";
+            break;
         default:
             break;
     }
 
+    if (webgl)
+    {
+        strstr << "_webgl";
+    }
+
+    if (offloadCalls)
+    {
+        strstr << "_offload";
+    }
+
     return strstr.str();
 }
 
@@ -135,13 +153,14 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   private:
-    GLuint mProgram1   = 0;
-    GLuint mProgram2   = 0;
-    GLuint mProgram3   = 0;
-    GLuint mBuffer1    = 0;
-    GLuint mBuffer2    = 0;
-    GLuint mFBO        = 0;
-    GLuint mFBOTexture = 0;
+    GLuint mProgram1    = 0;
+    GLuint mProgram2    = 0;
+    GLuint mProgram3    = 0;
+    GLuint mBuffer1     = 0;
+    GLuint mBuffer2     = 0;
+    GLuint mIndexBuffer = 0;
+    GLuint mFBO         = 0;
+    GLuint mFBOTexture  = 0;
     std::vector<GLuint> mTextures;
     int mNumTris = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
@@ -158,6 +177,8 @@ DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf",
     {
         skipTest("https://issuetracker.google.com/issues/298407224 Fails on Pixel 6 GLES");
     }
+
+    setWebGLCompatibilityEnabled(params.webgl);
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -280,6 +301,14 @@ void main()
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
 
+    if (params.stateChange == StateChange::ValidationOnly)
+    {
+        constexpr GLushort kIndices[] = {0, 1, 2};
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kIndices), kIndices, GL_STATIC_DRAW);
+    }
+
     // Set the viewport
     glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
 
@@ -342,6 +371,7 @@ void DrawCallPerfBenchmark::destroyBenchmark()
     glDeleteProgram(mProgram3);
     glDeleteBuffers(1, &mBuffer1);
     glDeleteBuffers(1, &mBuffer2);
+    glDeleteBuffers(1, &mIndexBuffer);
     glDeleteTextures(1, &mFBOTexture);
     glDeleteTextures(mTextures.size(), mTextures.data());
     glDeleteFramebuffers(1, &mFBO);
@@ -569,6 +599,17 @@ void UpdateUniformThenDraw(unsigned int iterations, GLsizei numElements)
     }
 }
 
+void ValidateDrawsOnly(unsigned int iterations)
+{
+    // Two vertices don't make a triangle, so the front-end drops these draws right after they are
+    // validated.  The attribute and index buffers are still checked in WebGL contexts.
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glDrawArrays(GL_TRIANGLES, 0, 2);
+        glDrawElements(GL_TRIANGLES, 2, GL_UNSIGNED_SHORT, nullptr);
+    }
+}
+
 void DrawCallPerfBenchmark::drawBenchmark()
 {
     // This workaround fixes a huge queue of graphics commands accumulating on the GL
@@ -625,6 +666,9 @@ void DrawCallPerfBenchmark::drawBenchmark()
         case StateChange::Uniform:
             UpdateUniformThenDraw(params.iterationsPerStep, numElements);
             break;
+        case StateChange::ValidationOnly:
+            ValidateDrawsOnly(params.iterationsPerStep);
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
@@ -654,15 +698,59 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams CombineWebGL(const DrawArraysPerfParams &in, bool webgl)
+{
+    DrawArraysPerfParams out = in;
+    out.webgl                = webgl;
+    return out;
+}
+
+// Only the validation-only draws are interesting in WebGL contexts.
+bool IsWebGLVariantTested(const DrawArraysPerfParams &params)
+{
+    return !params.webgl || params.stateChange == StateChange::ValidationOnly;
+}
+
+DrawArraysPerfParams CombineOffload(const DrawArraysPerfParams &in, bool offloadCalls)
+{
+    DrawArraysPerfParams out = in;
+    out.offloadCalls         = offloadCalls;
+    if (offloadCalls)
+    {
+        out.eglParameters.enable(Feature::OffloadGlCallsToWorkerThread);
+    }
+    return out;
+}
+
+// Compare offloading against the same Vulkan runs without it, for the draws whose state changes
+// are all offloaded.
+bool IsOffloadVariantTested(const DrawArraysPerfParams &params)
+{
+    if (!params.offloadCalls)
+    {
+        return true;
+    }
+
+    const bool offloadedStateChange = params.stateChange == StateChange::NoChange ||
+                                      params.stateChange == StateChange::Scissor ||
+                                      params.stateChange == StateChange::Uniform;
+    return params.getRenderer() == EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE && offloadedStateChange &&
+           !params.webgl;
+}
+
 using P = DrawArraysPerfParams;
 
-std::vector<P> gTestsWithStateChange =
-    CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
+std::vector<P> gTestsWithStateChange = FilterWithFunc(
+    CombineWithValues(CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange),
+                      {false, true}, CombineWebGL),
+    IsWebGLVariantTested);
 std::vector<P> gTestsWithRenderer =
     CombineWithFuncs(gTestsWithStateChange, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
 std::vector<P> gTestsWithDevice =
     CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
+std::vector<P> gTestsWithOffload = FilterWithFunc(
+    CombineWithValues(gTestsWithDevice, {false, true}, CombineOffload), IsOffloadVariantTested);
 
-ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithOffload);
 
 }  // anonymous namespace
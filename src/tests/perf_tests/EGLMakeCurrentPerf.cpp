@@ -5,6 +5,10 @@
 //
 // EGLMakeCurrentPerfTest:
 //   Performance test for eglMakeCurrent.
+// EGLMakeCurrentShareGroupPerfTest:
+//   Performance test for eglMakeCurrent between contexts of the same share group that each clear a
+//   pbuffer after they are made current, like a UI toolkit that switches contexts many times per
+//   frame.
 //
 
 #include "ANGLEPerfTest.h"
@@ -24,23 +28,39 @@ class EGLMakeCurrentPerfTest : public ANGLEPerfTest,
                                public WithParamInterface<angle::PlatformParameters>
 {
   public:
-    EGLMakeCurrentPerfTest();
+    EGLMakeCurrentPerfTest() : EGLMakeCurrentPerfTest("_run") {}
 
     void step() override;
     void SetUp() override;
     void TearDown() override;
 
-  private:
+  protected:
+    EGLMakeCurrentPerfTest(const std::string &story);
+
     OSWindow *mOSWindow;
     EGLDisplay mDisplay;
     EGLSurface mSurface;
     EGLConfig mConfig;
     std::array<EGLContext, 2> mContexts;
     std::unique_ptr<angle::Library> mEGLLibrary;
+    std::vector<const char *> mEnabledFeatureOverrides;
+};
+
+class EGLMakeCurrentShareGroupPerfTest : public EGLMakeCurrentPerfTest
+{
+  public:
+    EGLMakeCurrentShareGroupPerfTest()
+        : EGLMakeCurrentPerfTest(GetParam().eglParameters.enabledFeatureOverrides.empty()
+                                     ? "_share_group"
+                                     : "_share_group_deferred")
+    {}
+
+    void step() override;
+    void SetUp() override;
 };
 
-EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest()
-    : ANGLEPerfTest("EGLMakeCurrent", "", "_run", ITERATIONS),
+EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest(const std::string &story)
+    : ANGLEPerfTest("EGLMakeCurrent", "", story, ITERATIONS),
       mOSWindow(nullptr),
       mDisplay(EGL_NO_DISPLAY),
       mSurface(EGL_NO_SURFACE),
@@ -58,6 +78,18 @@ EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest()
     displayAttributes.push_back(platform.minorVersion);
     displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
     displayAttributes.push_back(platform.deviceType);
+
+    for (angle::Feature feature : platform.enabledFeatureOverrides)
+    {
+        mEnabledFeatureOverrides.push_back(angle::GetFeatureName(feature));
+    }
+    if (!mEnabledFeatureOverrides.empty())
+    {
+        mEnabledFeatureOverrides.push_back(nullptr);
+        displayAttributes.push_back(EGL_FEATURE_OVERRIDES_ENABLED_ANGLE);
+        displayAttributes.push_back(reinterpret_cast<EGLAttrib>(mEnabledFeatureOverrides.data()));
+    }
+
     displayAttributes.push_back(EGL_NONE);
 
     mOSWindow = OSWindow::New();
@@ -143,11 +175,63 @@ void EGLMakeCurrentPerfTest::step()
     }
 }
 
+void EGLMakeCurrentShareGroupPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+    EGLint majorVersion, minorVersion;
+    ASSERT_TRUE(eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    EGLint numConfigs;
+    EGLint configAttrs[] = {EGL_RED_SIZE,
+                            8,
+                            EGL_GREEN_SIZE,
+                            8,
+                            EGL_BLUE_SIZE,
+                            8,
+                            EGL_RENDERABLE_TYPE,
+                            GetParam().majorVersion == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT,
+                            EGL_SURFACE_TYPE,
+                            EGL_PBUFFER_BIT,
+                            EGL_NONE};
+
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &mConfig, 1, &numConfigs));
+
+    mContexts[0] = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, nullptr);
+    ASSERT_NE(EGL_NO_CONTEXT, mContexts[0]);
+    mContexts[1] = eglCreateContext(mDisplay, mConfig, mContexts[0], nullptr);
+    ASSERT_NE(EGL_NO_CONTEXT, mContexts[1]);
+
+    EGLint surfaceAttrs[] = {EGL_WIDTH, 64, EGL_HEIGHT, 64, EGL_NONE};
+    mSurface              = eglCreatePbufferSurface(mDisplay, mConfig, surfaceAttrs);
+    ASSERT_NE(EGL_NO_SURFACE, mSurface);
+    ASSERT_TRUE(eglMakeCurrent(mDisplay, mSurface, mSurface, mContexts[0]));
+}
+
+void EGLMakeCurrentShareGroupPerfTest::step()
+{
+    int mCurrContext = 0;
+    for (int x = 0; x < ITERATIONS; x++)
+    {
+        mCurrContext = (mCurrContext + 1) % mContexts.size();
+        eglMakeCurrent(mDisplay, mSurface, mSurface, mContexts[mCurrContext]);
+
+        glClearColor(static_cast<float>(x % 2), 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+}
+
 TEST_P(EGLMakeCurrentPerfTest, Run)
 {
     run();
 }
 
+TEST_P(EGLMakeCurrentShareGroupPerfTest, Run)
+{
+    run();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMakeCurrentPerfTest);
 // We want to run this test on GL(ES) and Vulkan everywhere except Android
 #if !defined(ANGLE_PLATFORM_ANDROID)
@@ -157,6 +241,12 @@ ANGLE_INSTANTIATE_TEST(EGLMakeCurrentPerfTest,
                        angle::ES2_OPENGL(),
                        angle::ES2_OPENGLES(),
                        angle::ES2_VULKAN());
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMakeCurrentShareGroupPerfTest);
+ANGLE_INSTANTIATE_TEST(EGLMakeCurrentShareGroupPerfTest,
+                       angle::ES2_VULKAN(),
+                       angle::ES2_VULKAN().enable(
+                           angle::Feature::DeferSubmissionOnShareGroupContextSwitch));
 #endif
 
 }  // namespace
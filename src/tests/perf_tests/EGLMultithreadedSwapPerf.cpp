@@ -0,0 +1,198 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLMultithreadedSwapPerf:
+//   Stress test for the EGL locks.  Several threads each render to their own window and swap it,
+//   like an application that renders to several windows from separate threads.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#include "test_utils/angle_test_instantiate.h"
+#include "util/OSWindow.h"
+
+namespace angle
+{
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+
+struct EGLMultithreadedSwapParams final : public RenderTestParams
+{
+    EGLMultithreadedSwapParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+    }
+
+    std::string story() const override;
+
+    // Each thread renders to its own window with its own context, and swaps it once per iteration.
+    unsigned int threadCount = 4;
+};
+
+std::ostream &operator<<(std::ostream &os, const EGLMultithreadedSwapParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string EGLMultithreadedSwapParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << "_" << threadCount << "_threads";
+
+    const std::vector<Feature> &disabledFeatures = eglParameters.disabledFeatureOverrides;
+    if (std::find(disabledFeatures.begin(), disabledFeatures.end(),
+                  Feature::SwapBuffersWithoutGlobalLock) != disabledFeatures.end())
+    {
+        strstr << "_global_lock";
+    }
+
+    return strstr.str();
+}
+
+class EGLMultithreadedSwapBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<EGLMultithreadedSwapParams>
+{
+  public:
+    EGLMultithreadedSwapBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    struct ThreadTarget
+    {
+        OSWindow *window   = nullptr;
+        EGLSurface surface = EGL_NO_SURFACE;
+        EGLContext context = EGL_NO_CONTEXT;
+    };
+
+    void swapThread(const ThreadTarget &target, unsigned int swapCount) const;
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+    std::vector<ThreadTarget> mTargets;
+};
+
+EGLMultithreadedSwapBenchmark::EGLMultithreadedSwapBenchmark()
+    : ANGLERenderTest("EGLMultithreadedSwap", GetParam())
+{}
+
+void EGLMultithreadedSwapBenchmark::initializeBenchmark()
+{
+    const EGLMultithreadedSwapParams &params = GetParam();
+
+    mDisplay               = eglGetCurrentDisplay();
+    EGLContext context     = eglGetCurrentContext();
+    EGLint configID        = 0;
+    EGLint configAttribs[] = {EGL_CONFIG_ID, 0, EGL_NONE};
+    EGLConfig config       = nullptr;
+    EGLint numConfigs      = 0;
+    ASSERT_TRUE(eglQueryContext(mDisplay, context, EGL_CONFIG_ID, &configID));
+    configAttribs[1] = configID;
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttribs, &config, 1, &numConfigs));
+
+    EGLint contextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION_KHR, params.majorVersion,
+                               EGL_CONTEXT_MINOR_VERSION_KHR, params.minorVersion, EGL_NONE};
+
+    mTargets.resize(params.threadCount);
+    for (ThreadTarget &target : mTargets)
+    {
+        target.window = OSWindow::New();
+        ASSERT_TRUE(target.window->initialize("EGLMultithreadedSwap", params.windowWidth,
+                                              params.windowHeight));
+        target.window->setVisible(true);
+
+        target.surface =
+            eglCreateWindowSurface(mDisplay, config, target.window->getNativeWindow(), nullptr);
+        ASSERT_NE(EGL_NO_SURFACE, target.surface);
+
+        target.context = eglCreateContext(mDisplay, config, EGL_NO_CONTEXT, contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, target.context);
+    }
+}
+
+void EGLMultithreadedSwapBenchmark::destroyBenchmark()
+{
+    for (ThreadTarget &target : mTargets)
+    {
+        eglDestroyContext(mDisplay, target.context);
+        eglDestroySurface(mDisplay, target.surface);
+        target.window->destroy();
+        OSWindow::Delete(&target.window);
+    }
+    mTargets.clear();
+}
+
+void EGLMultithreadedSwapBenchmark::swapThread(const ThreadTarget &target,
+                                               unsigned int swapCount) const
+{
+    eglMakeCurrent(mDisplay, target.surface, target.surface, target.context);
+    eglSwapInterval(mDisplay, 0);
+
+    for (unsigned int swap = 0; swap < swapCount; ++swap)
+    {
+        glClearColor(static_cast<float>(swap & 1), 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        eglSwapBuffers(mDisplay, target.surface);
+    }
+
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+void EGLMultithreadedSwapBenchmark::drawBenchmark()
+{
+    const EGLMultithreadedSwapParams &params = GetParam();
+
+    std::vector<std::thread> threads;
+    threads.reserve(mTargets.size());
+    for (const ThreadTarget &target : mTargets)
+    {
+        threads.emplace_back(&EGLMultithreadedSwapBenchmark::swapThread, this, std::cref(target),
+                             params.iterationsPerStep);
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+EGLMultithreadedSwapParams VulkanParams(unsigned int threadCount, bool swapWithoutGlobalLock)
+{
+    EGLMultithreadedSwapParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.threadCount   = threadCount;
+    if (!swapWithoutGlobalLock)
+    {
+        params.eglParameters.disable(Feature::SwapBuffersWithoutGlobalLock);
+    }
+    return params;
+}
+
+TEST_P(EGLMultithreadedSwapBenchmark, Run)
+{
+    run();
+}
+}  // namespace
+
+ANGLE_INSTANTIATE_TEST(EGLMultithreadedSwapBenchmark,
+                       VulkanParams(1, true),
+                       VulkanParams(4, true),
+                       VulkanParams(4, false));
+
+}  // namespace angle
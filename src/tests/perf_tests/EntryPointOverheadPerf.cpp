@@ -0,0 +1,193 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointOverheadPerf:
+//   Performance test for the fixed cost of a GL call: looking up the current context and taking
+//   the share context lock.  The calls themselves do next to no work.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "test_utils/angle_test_instantiate.h"
+
+namespace angle
+{
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+constexpr unsigned int kCallsPerIteration = 2000;
+
+enum class EntryPointType
+{
+    // Entry points that only touch context-private state and never take the share context lock.
+    ContextPrivate,
+    // Entry points that take the share context lock.  Without the context mutex, the lock is the
+    // global mutex and is only taken if the context is shared.
+    ShareContextLock,
+};
+
+struct EntryPointOverheadParams final : public RenderTestParams
+{
+    EntryPointOverheadParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+    }
+
+    std::string story() const override;
+
+    EntryPointType entryPointType = EntryPointType::ShareContextLock;
+    // Create a second context in the same share group, so the context is shared.
+    bool sharedContext = false;
+    // Hand the calls to a worker thread (offloadGlCallsToWorkerThread).  The calls are then only
+    // recorded on the calling thread.
+    bool offloadCalls = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const EntryPointOverheadParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string EntryPointOverheadParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << (entryPointType == EntryPointType::ContextPrivate ? "_context_private"
+                                                                : "_share_context_lock");
+    if (sharedContext)
+    {
+        strstr << "_shared";
+    }
+    if (offloadCalls)
+    {
+        strstr << "_offload";
+    }
+
+    return strstr.str();
+}
+
+class EntryPointOverheadBenchmark : public ANGLERenderTest,
+                                    public ::testing::WithParamInterface<EntryPointOverheadParams>
+{
+  public:
+    EntryPointOverheadBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mBuffer           = 0;
+    EGLDisplay mDisplay      = EGL_NO_DISPLAY;
+    EGLContext mShareContext = EGL_NO_CONTEXT;
+};
+
+EntryPointOverheadBenchmark::EntryPointOverheadBenchmark()
+    : ANGLERenderTest("EntryPointOverhead", GetParam())
+{}
+
+void EntryPointOverheadBenchmark::initializeBenchmark()
+{
+    const EntryPointOverheadParams &params = GetParam();
+
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+
+    if (params.sharedContext)
+    {
+        mDisplay               = eglGetCurrentDisplay();
+        EGLContext context     = eglGetCurrentContext();
+        EGLint configID        = 0;
+        EGLint configAttribs[] = {EGL_CONFIG_ID, 0, EGL_NONE};
+        EGLConfig config       = nullptr;
+        EGLint numConfigs      = 0;
+        ASSERT_TRUE(eglQueryContext(mDisplay, context, EGL_CONFIG_ID, &configID));
+        configAttribs[1] = configID;
+        ASSERT_TRUE(eglChooseConfig(mDisplay, configAttribs, &config, 1, &numConfigs));
+
+        EGLint contextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION_KHR, params.majorVersion,
+                                   EGL_CONTEXT_MINOR_VERSION_KHR, params.minorVersion, EGL_NONE};
+        mShareContext = eglCreateContext(mDisplay, config, context, contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, mShareContext);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void EntryPointOverheadBenchmark::destroyBenchmark()
+{
+    if (mShareContext != EGL_NO_CONTEXT)
+    {
+        eglDestroyContext(mDisplay, mShareContext);
+        mShareContext = EGL_NO_CONTEXT;
+    }
+
+    glDeleteBuffers(1, &mBuffer);
+}
+
+void EntryPointOverheadBenchmark::drawBenchmark()
+{
+    const EntryPointOverheadParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        if (params.entryPointType == EntryPointType::ContextPrivate)
+        {
+            for (unsigned int call = 0; call < kCallsPerIteration; ++call)
+            {
+                glStencilMask((call & 1) != 0 ? 0xFF : 0x0F);
+            }
+        }
+        else
+        {
+            for (unsigned int call = 0; call < kCallsPerIteration; ++call)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, (call & 1) != 0 ? mBuffer : 0);
+            }
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+EntryPointOverheadParams VulkanParams(EntryPointType entryPointType,
+                                      bool sharedContext,
+                                      bool offloadCalls)
+{
+    EntryPointOverheadParams params;
+    params.eglParameters  = egl_platform::VULKAN_NULL();
+    params.entryPointType = entryPointType;
+    params.sharedContext  = sharedContext;
+    params.offloadCalls   = offloadCalls;
+    if (offloadCalls)
+    {
+        params.enable(Feature::OffloadGlCallsToWorkerThread);
+    }
+    return params;
+}
+
+TEST_P(EntryPointOverheadBenchmark, Run)
+{
+    run();
+}
+}  // namespace
+
+ANGLE_INSTANTIATE_TEST(EntryPointOverheadBenchmark,
+                       VulkanParams(EntryPointType::ContextPrivate, false, false),
+                       VulkanParams(EntryPointType::ContextPrivate, false, true),
+                       VulkanParams(EntryPointType::ShareContextLock, false, false),
+                       VulkanParams(EntryPointType::ShareContextLock, false, true),
+                       VulkanParams(EntryPointType::ShareContextLock, true, false));
+
+}  // namespace angle
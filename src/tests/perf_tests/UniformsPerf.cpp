@@ -24,11 +24,17 @@ namespace
 {
 constexpr unsigned int kIterationsPerStep = 4;
 
+// The number of uniforms changed per draw with DataMode::SPARSE.
+constexpr size_t kSparseUpdatesPerDraw = 2;
+
 // Controls when we call glUniform, if the data is the same as last frame.
 enum DataMode
 {
     UPDATE,
     REPEAT,
+    // Change only a couple of uniforms per draw, which is typical of applications with large
+    // default uniform blocks.
+    SPARSE,
 };
 
 // TODO(jmadill): Use an ANGLE enum for this?
@@ -120,6 +126,10 @@ std::string UniformsParams::story() const
     {
         strstr << "_repeating";
     }
+    else if (dataMode == DataMode::SPARSE)
+    {
+        strstr << "_sparse";
+    }
 
     return strstr.str();
 }
@@ -145,6 +155,9 @@ class UniformsBenchmark : public ANGLERenderTest,
 
     using MatrixData = std::array<std::vector<Matrix4>, 2>;
     MatrixData mMatrixData;
+
+    // The number of uniform updates made so far with DataMode::SPARSE.
+    size_t mSparseUpdateCount = 0;
 };
 
 std::vector<Matrix4> GenMatrixData(size_t count, int parity)
@@ -399,6 +412,18 @@ void UniformsBenchmark::drawLoop(const SetUniformFunc &setUniformsFunc)
                 setUniformsFunc(mUniformLocations, mMatrixData, uniform, frameIndex);
             }
         }
+        else if (params.dataMode == DataMode::SPARSE)
+        {
+            // Walk through the uniforms a few at a time, alternating the data on every pass so
+            // that each update actually changes the value.
+            for (size_t update = 0; update < kSparseUpdatesPerDraw; ++update)
+            {
+                const size_t uniform   = mSparseUpdateCount % mUniformLocations.size();
+                const size_t dataIndex = (mSparseUpdateCount / mUniformLocations.size()) % 2;
+                setUniformsFunc(mUniformLocations, mMatrixData, uniform, dataIndex);
+                ++mSparseUpdateCount;
+            }
+        }
         glDrawArrays(GL_TRIANGLES, 0, 3);
     }
 }
@@ -448,7 +473,7 @@ void UniformsBenchmark::drawBenchmark()
         {
             auto setFunc = [](const std::vector<GLuint> &locations, const MatrixData &matrixData,
                               size_t uniform, size_t frameIndex) {
-                float value = static_cast<float>(uniform);
+                float value = static_cast<float>(uniform + frameIndex);
                 glUniform4f(locations[uniform], value, value, value, value);
             };
 
@@ -533,4 +558,10 @@ ANGLE_INSTANTIATE_TEST(
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::UPDATE, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
+    VectorUniforms(OPENGL_OR_GLES(), DataMode::SPARSE),
+    VectorUniforms(VULKAN_NULL(), DataMode::SPARSE),
+    VectorUniforms(VULKAN_NULL(), DataMode::SPARSE, ProgramMode::MULTIPLE),
+    VectorUniforms(VULKAN(), DataMode::SPARSE),
+    MatrixUniforms(VULKAN_NULL(), DataMode::SPARSE, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
+    MatrixUniforms(VULKAN(), DataMode::SPARSE, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
     VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE));
@@ -72,6 +72,7 @@ class VulkanBarriersPerfBenchmark : public ANGLERenderTest,
     void createUniformBuffer();
     void createFramebuffer(uint32_t fboIndex, uint32_t textureIndex, uint32_t sizeIndex);
     void createResources();
+    void sampleBarrierCounts();
 
     // Handle to the program object
     GLProgram mProgram;
@@ -107,6 +108,12 @@ class VulkanBarriersPerfBenchmark : public ANGLERenderTest,
     static constexpr size_t kTransferTexture1Index = 2;
     static constexpr size_t kTransferTexture2Index = 3;
 
+    // Barriers requested by the backend vs vkCmdPipelineBarrier calls issued after batching, per
+    // frame.  Only sampled if GL_AMD_performance_monitor is available.
+    CounterNameToIndexMap mCounterIndexMap;
+    std::vector<uint64_t> mBarriersRequestedPerFrame;
+    std::vector<uint64_t> mBarriersIssuedPerFrame;
+
     static constexpr size_t kSmallSizeIndex = 0;
     static constexpr size_t kLargeSizeIndex = 1;
     static constexpr size_t kHugeSizeIndex  = 2;
@@ -270,16 +277,52 @@ void VulkanBarriersPerfBenchmark::createResources()
     }
 }
 
+void VulkanBarriersPerfBenchmark::sampleBarrierCounts()
+{
+    if (mCounterIndexMap.empty())
+    {
+        return;
+    }
+
+    // The barrier counters are reset on every swap, so they hold this frame's counts.
+    angle::VulkanPerfCounters counters = GetPerfCounters(mCounterIndexMap);
+    mBarriersRequestedPerFrame.push_back(counters.pipelineBarriersRequested);
+    mBarriersIssuedPerFrame.push_back(counters.pipelineBarriersIssued);
+}
+
 void VulkanBarriersPerfBenchmark::initializeBenchmark()
 {
     createResources();
 
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
+    if (IsGLExtensionEnabled(kPerfMonitorExtensionName))
+    {
+        mCounterIndexMap = BuildCounterNameToIndexMap();
+    }
+
     ASSERT_GL_NO_ERROR();
 }
 
-void VulkanBarriersPerfBenchmark::destroyBenchmark() {}
+void VulkanBarriersPerfBenchmark::destroyBenchmark()
+{
+    if (mBarriersRequestedPerFrame.empty())
+    {
+        return;
+    }
+
+    auto average = [](const std::vector<uint64_t> &samples) {
+        uint64_t sum = 0;
+        for (uint64_t sample : samples)
+        {
+            sum += sample;
+        }
+        return static_cast<double>(sum) / static_cast<double>(samples.size());
+    };
+
+    mReporter->AddResult(".barriers_requested_per_frame", average(mBarriersRequestedPerFrame));
+    mReporter->AddResult(".barriers_issued_per_frame", average(mBarriersIssuedPerFrame));
+}
 
 void VulkanBarriersPerfBenchmark::drawBenchmark()
 {
@@ -393,6 +436,8 @@ void VulkanBarriersPerfBenchmark::drawBenchmark()
     }
     stopGpuTimer();
 
+    sampleBarrierCounts();
+
     ASSERT_GL_NO_ERROR();
 }
 
@@ -50,6 +50,8 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AppendAliasedMemoryDecorations, "appendAliasedMemoryDecorations"},
     {Feature::AsyncCommandBufferReset, "asyncCommandBufferReset"},
     {Feature::AsyncGarbageCleanup, "asyncGarbageCleanup"},
+    {Feature::AsyncQueueSubmit, "asyncQueueSubmit"},
+    {Feature::AsyncRenderPassReplay, "asyncRenderPassReplay"},
     {Feature::Avoid1BitAlphaTextureFormats, "avoid1BitAlphaTextureFormats"},
     {Feature::AvoidBindFragDataLocation, "avoidBindFragDataLocation"},
     {Feature::AvoidInvisibleWindowSwapchainRecreate, "avoidInvisibleWindowSwapchainRecreate"},
@@ -62,6 +64,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::BorderColorSrgb, "borderColorSrgb"},
     {Feature::BottomLeftOriginPresentRegionRectangles, "bottomLeftOriginPresentRegionRectangles"},
     {Feature::BresenhamLineRasterization, "bresenhamLineRasterization"},
+    {Feature::BudgetAwareAllocation, "budgetAwareAllocation"},
     {Feature::CacheCompiledShader, "cacheCompiledShader"},
     {Feature::CallClearTwice, "callClearTwice"},
     {Feature::ClampArrayAccess, "clampArrayAccess"},
@@ -69,14 +72,17 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ClampMscRate, "clampMscRate"},
     {Feature::ClampPointSize, "clampPointSize"},
     {Feature::ClDumpVkSpirv, "clDumpVkSpirv"},
+    {Feature::ClearScissoredAttachmentsWithLoadOp, "clearScissoredAttachmentsWithLoadOp"},
     {Feature::ClearsWithGapsNeedFlush, "clearsWithGapsNeedFlush"},
     {Feature::ClipSrcRegionForBlitFramebuffer, "clipSrcRegionForBlitFramebuffer"},
     {Feature::CompileJobIsThreadSafe, "compileJobIsThreadSafe"},
     {Feature::CompressVertexData, "compressVertexData"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization, "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
+    {Feature::CopyOcclusionQueryResultsToBuffer, "copyOcclusionQueryResultsToBuffer"},
     {Feature::CopyTextureToBufferForReadOptimization, "copyTextureToBufferForReadOptimization"},
     {Feature::CorruptProgramBinaryForTesting, "corruptProgramBinaryForTesting"},
     {Feature::DecodeEncodeSRGBForGenerateMipmap, "decodeEncodeSRGBForGenerateMipmap"},
+    {Feature::DeferSubmissionOnShareGroupContextSwitch, "deferSubmissionOnShareGroupContextSwitch"},
     {Feature::DepthStencilBlitExtraCopy, "depthStencilBlitExtraCopy"},
     {Feature::DescriptorSetCache, "descriptorSetCache"},
     {Feature::DestroyOldSwapchainInSharedPresentMode, "destroyOldSwapchainInSharedPresentMode"},
@@ -228,9 +234,11 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::LoseContextOnOutOfMemory, "loseContextOnOutOfMemory"},
     {Feature::MapUnspecifiedColorSpaceToPassThrough, "mapUnspecifiedColorSpaceToPassThrough"},
     {Feature::MergeProgramPipelineCachesToGlobalCache, "mergeProgramPipelineCachesToGlobalCache"},
+    {Feature::MergeRenderPassesAcrossFramebuffers, "mergeRenderPassesAcrossFramebuffers"},
     {Feature::MrtPerfWorkaround, "mrtPerfWorkaround"},
     {Feature::MultisampleColorFormatShaderReadWorkaround, "multisampleColorFormatShaderReadWorkaround"},
     {Feature::MutableMipmapTextureUpload, "mutableMipmapTextureUpload"},
+    {Feature::OffloadGlCallsToWorkerThread, "offloadGlCallsToWorkerThread"},
     {Feature::OverrideSurfaceFormatRGB8ToRGBA8, "overrideSurfaceFormatRGB8ToRGBA8"},
     {Feature::PackLastRowSeparatelyForPaddingInclusion, "packLastRowSeparatelyForPaddingInclusion"},
     {Feature::PackOverlappingRowsSeparatelyPackBuffer, "packOverlappingRowsSeparatelyPackBuffer"},
@@ -259,6 +267,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::PreTransformTextureCubeGradDerivatives, "preTransformTextureCubeGradDerivatives"},
     {Feature::PromotePackedFormatsTo8BitPerChannel, "promotePackedFormatsTo8BitPerChannel"},
     {Feature::ProvokingVertex, "provokingVertex"},
+    {Feature::PushTextureDescriptors, "pushTextureDescriptors"},
     {Feature::QueryCounterBitsGeneratesErrors, "queryCounterBitsGeneratesErrors"},
     {Feature::ReadPixelsUsingImplementationColorReadFormatForNorm16, "readPixelsUsingImplementationColorReadFormatForNorm16"},
     {Feature::ReapplyUBOBindingsAfterUsingBinaryProgram, "reapplyUBOBindingsAfterUsingBinaryProgram"},
@@ -290,6 +299,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SkipPipelineCacheSerialization, "skipPipelineCacheSerialization"},
     {Feature::SkipVSConstantRegisterZero, "skipVSConstantRegisterZero"},
     {Feature::SlowDownMonolithicPipelineCreationForTesting, "slowDownMonolithicPipelineCreationForTesting"},
+    {Feature::SpeculativeReadbackForDeviceLocalBuffers, "speculativeReadbackForDeviceLocalBuffers"},
     {Feature::SrgbBlendingBroken, "srgbBlendingBroken"},
     {Feature::Supports16BitInputOutput, "supports16BitInputOutput"},
     {Feature::Supports16BitPushConstant, "supports16BitPushConstant"},
@@ -376,6 +386,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsPrimitivesGeneratedQuery, "supportsPrimitivesGeneratedQuery"},
     {Feature::SupportsPrimitiveTopologyListRestart, "supportsPrimitiveTopologyListRestart"},
     {Feature::SupportsProtectedMemory, "supportsProtectedMemory"},
+    {Feature::SupportsPushDescriptor, "supportsPushDescriptor"},
     {Feature::SupportsRasterizationOrderAttachmentAccess, "supportsRasterizationOrderAttachmentAccess"},
     {Feature::SupportsRenderpass2, "supportsRenderpass2"},
     {Feature::SupportsRenderPassLoadStoreOpNone, "supportsRenderPassLoadStoreOpNone"},
@@ -420,6 +431,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsYUVSamplerConversion, "supportsYUVSamplerConversion"},
     {Feature::SupportsYuvTarget, "supportsYuvTarget"},
     {Feature::SwapbuffersOnFlushOrFinishWithSingleBuffer, "swapbuffersOnFlushOrFinishWithSingleBuffer"},
+    {Feature::SwapBuffersWithoutGlobalLock, "swapBuffersWithoutGlobalLock"},
     {Feature::SyncAllVertexArraysToDefault, "syncAllVertexArraysToDefault"},
     {Feature::SyncDefaultVertexArraysToDefault, "syncDefaultVertexArraysToDefault"},
     {Feature::SyncMonolithicPipelinesToBlobCache, "syncMonolithicPipelinesToBlobCache"},
@@ -451,6 +463,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseStencilOpDynamicState, "useStencilOpDynamicState"},
     {Feature::UseStencilTestEnableDynamicState, "useStencilTestEnableDynamicState"},
     {Feature::UseSystemMemoryForConstantBuffers, "useSystemMemoryForConstantBuffers"},
+    {Feature::UseTimelineSemaphoreForSubmissions, "useTimelineSemaphoreForSubmissions"},
     {Feature::UseUnusedBlocksWithStandardOrSharedLayout, "useUnusedBlocksWithStandardOrSharedLayout"},
     {Feature::UseVertexInputBindingStrideDynamicState, "useVertexInputBindingStrideDynamicState"},
     {Feature::UseVkEventForBufferBarrier, "useVkEventForBufferBarrier"},
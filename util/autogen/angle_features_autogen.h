@@ -50,6 +50,8 @@ enum class Feature
     AppendAliasedMemoryDecorations,
     AsyncCommandBufferReset,
     AsyncGarbageCleanup,
+    AsyncQueueSubmit,
+    AsyncRenderPassReplay,
     Avoid1BitAlphaTextureFormats,
     AvoidBindFragDataLocation,
     AvoidInvisibleWindowSwapchainRecreate,
@@ -62,6 +64,7 @@ enum class Feature
     BorderColorSrgb,
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
+    BudgetAwareAllocation,
     CacheCompiledShader,
     CallClearTwice,
     ClampArrayAccess,
@@ -69,14 +72,17 @@ enum class Feature
     ClampMscRate,
     ClampPointSize,
     ClDumpVkSpirv,
+    ClearScissoredAttachmentsWithLoadOp,
     ClearsWithGapsNeedFlush,
     ClipSrcRegionForBlitFramebuffer,
     CompileJobIsThreadSafe,
     CompressVertexData,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
+    CopyOcclusionQueryResultsToBuffer,
     CopyTextureToBufferForReadOptimization,
     CorruptProgramBinaryForTesting,
     DecodeEncodeSRGBForGenerateMipmap,
+    DeferSubmissionOnShareGroupContextSwitch,
     DepthStencilBlitExtraCopy,
     DescriptorSetCache,
     DestroyOldSwapchainInSharedPresentMode,
@@ -228,9 +234,11 @@ enum class Feature
     LoseContextOnOutOfMemory,
     MapUnspecifiedColorSpaceToPassThrough,
     MergeProgramPipelineCachesToGlobalCache,
+    MergeRenderPassesAcrossFramebuffers,
     MrtPerfWorkaround,
     MultisampleColorFormatShaderReadWorkaround,
     MutableMipmapTextureUpload,
+    OffloadGlCallsToWorkerThread,
     OverrideSurfaceFormatRGB8ToRGBA8,
     PackLastRowSeparatelyForPaddingInclusion,
     PackOverlappingRowsSeparatelyPackBuffer,
@@ -259,6 +267,7 @@ enum class Feature
     PreTransformTextureCubeGradDerivatives,
     PromotePackedFormatsTo8BitPerChannel,
     ProvokingVertex,
+    PushTextureDescriptors,
     QueryCounterBitsGeneratesErrors,
     ReadPixelsUsingImplementationColorReadFormatForNorm16,
     ReapplyUBOBindingsAfterUsingBinaryProgram,
@@ -290,6 +299,7 @@ enum class Feature
     SkipPipelineCacheSerialization,
     SkipVSConstantRegisterZero,
     SlowDownMonolithicPipelineCreationForTesting,
+    SpeculativeReadbackForDeviceLocalBuffers,
     SrgbBlendingBroken,
     Supports16BitInputOutput,
     Supports16BitPushConstant,
@@ -376,6 +386,7 @@ enum class Feature
     SupportsPrimitivesGeneratedQuery,
     SupportsPrimitiveTopologyListRestart,
     SupportsProtectedMemory,
+    SupportsPushDescriptor,
     SupportsRasterizationOrderAttachmentAccess,
     SupportsRenderpass2,
     SupportsRenderPassLoadStoreOpNone,
@@ -420,6 +431,7 @@ enum class Feature
     SupportsYUVSamplerConversion,
     SupportsYuvTarget,
     SwapbuffersOnFlushOrFinishWithSingleBuffer,
+    SwapBuffersWithoutGlobalLock,
     SyncAllVertexArraysToDefault,
     SyncDefaultVertexArraysToDefault,
     SyncMonolithicPipelinesToBlobCache,
@@ -451,6 +463,7 @@ enum class Feature
     UseStencilOpDynamicState,
     UseStencilTestEnableDynamicState,
     UseSystemMemoryForConstantBuffers,
+    UseTimelineSemaphoreForSubmissions,
     UseUnusedBlocksWithStandardOrSharedLayout,
     UseVertexInputBindingStrideDynamicState,
     UseVkEventForBufferBarrier,